@@ -0,0 +1,186 @@
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "parser.h"
+#include "instancia.h"
+#include "localizador_itens.h"
+#include "verificador_disponibilidade.h"
+#include "analisador_relevancia.h"
+#include "solucionar_desafio.h"
+
+// Micro-benchmarks dos kernels do solver, um por instância de data/input.
+// Uso: benchmark_kernels [--instancias <dir>] [opções do Google Benchmark, ex.: --benchmark_filter=Parser]
+// A vazão é reportada como pedidos/s (pedidos da instância processados por segundo).
+
+#ifndef DIRETORIO_INSTANCIAS_PADRAO
+#define DIRETORIO_INSTANCIAS_PADRAO "data/input"
+#endif
+
+namespace {
+
+void registrarVazao(benchmark::State& state, const Backlog& backlog) {
+    state.counters["pedidos/s"] = benchmark::Counter(static_cast<double>(backlog.numPedidos),
+                                                     benchmark::Counter::kIsIterationInvariantRate);
+}
+
+void BM_ParseFile(benchmark::State& state, const std::string& arquivo, InstanciaPtr instancia) {
+    // Silenciar as mensagens do parser durante a medição (cout sem buffer descarta a saída)
+    std::streambuf* saidaOriginal = std::cout.rdbuf(nullptr);
+    for (auto _ : state) {
+        InputParser parser;
+        auto dados = parser.parseFile(arquivo);
+        benchmark::DoNotOptimize(dados);
+    }
+    std::cout.rdbuf(saidaOriginal);
+    std::cout.clear();
+    registrarVazao(state, instancia->getBacklog());
+}
+
+void BM_LocalizadorConstruir(benchmark::State& state, InstanciaPtr instancia) {
+    const Deposito& deposito = instancia->getDeposito();
+    for (auto _ : state) {
+        LocalizadorItens localizador(deposito.numItens);
+        localizador.construir(deposito);
+        benchmark::DoNotOptimize(localizador.inicioItem.data());
+    }
+    registrarVazao(state, instancia->getBacklog());
+}
+
+void BM_VerificadorConstruir(benchmark::State& state, InstanciaPtr instancia) {
+    const Deposito& deposito = instancia->getDeposito();
+    for (auto _ : state) {
+        VerificadorDisponibilidade verificador(deposito.numItens);
+        verificador.construir(deposito);
+        verificador.indexarPedidos(instancia->getBacklog());
+        benchmark::DoNotOptimize(verificador.pedidosAtendiveis.data());
+    }
+    registrarVazao(state, instancia->getBacklog());
+}
+
+void BM_AnalisadorConstruir(benchmark::State& state, InstanciaPtr instancia) {
+    const Backlog& backlog = instancia->getBacklog();
+    const LocalizadorItens& localizador = instancia->getLocalizador();
+    for (auto _ : state) {
+        AnalisadorRelevancia analisador(backlog.numPedidos);
+        analisador.construir(backlog, localizador, 1);
+        benchmark::DoNotOptimize(analisador.numUnidades.data());
+    }
+    registrarVazao(state, backlog);
+}
+
+void BM_GerarSolucaoInicial(benchmark::State& state, InstanciaPtr instancia) {
+    for (auto _ : state) {
+        Solucao solucao = gerarSolucaoInicial(instancia->getDeposito(), instancia->getBacklog(),
+                                              instancia->getLocalizador(), instancia->getVerificador(),
+                                              instancia->getAnalisador());
+        benchmark::DoNotOptimize(solucao.valorObjetivo);
+    }
+    registrarVazao(state, instancia->getBacklog());
+}
+
+// Os kernels abaixo partem da solução inicial, calculada uma vez fora do laço medido
+Solucao solucaoDePartida(const InstanciaPtr& instancia) {
+    return gerarSolucaoInicial(instancia->getDeposito(), instancia->getBacklog(), instancia->getLocalizador(),
+                               instancia->getVerificador(), instancia->getAnalisador());
+}
+
+void BM_PerturbarSolucao(benchmark::State& state, InstanciaPtr instancia) {
+    Solucao inicial = solucaoDePartida(instancia);
+    definirSemente(42);
+    for (auto _ : state) {
+        Solucao solucao = perturbarSolucao(instancia->getDeposito(), instancia->getBacklog(), inicial,
+                                           instancia->getLocalizador(), instancia->getVerificador(),
+                                           instancia->getAnalisador());
+        benchmark::DoNotOptimize(solucao.valorObjetivo);
+    }
+    registrarVazao(state, instancia->getBacklog());
+}
+
+// Regime permanente da busca: área de trabalho e solução de destino reaproveitadas
+void BM_PerturbarSolucaoArea(benchmark::State& state, InstanciaPtr instancia) {
+    Solucao inicial = solucaoDePartida(instancia);
+    AreaTrabalhoBusca area(instancia->getLocalizador());
+    Solucao solucao;
+    definirSemente(42);
+    for (auto _ : state) {
+        perturbarSolucao(instancia->getDeposito(), instancia->getBacklog(), inicial, instancia->getVerificador(),
+                         instancia->getAnalisador(), area, solucao);
+        benchmark::DoNotOptimize(solucao.valorObjetivo);
+    }
+    registrarVazao(state, instancia->getBacklog());
+}
+
+void BM_AjustarSolucao(benchmark::State& state, InstanciaPtr instancia) {
+    Solucao inicial = solucaoDePartida(instancia);
+    for (auto _ : state) {
+        Solucao solucao = ajustarSolucao(instancia->getDeposito(), instancia->getBacklog(), inicial,
+                                         instancia->getLocalizador(), instancia->getVerificador(),
+                                         instancia->getAnalisador());
+        benchmark::DoNotOptimize(solucao.valorObjetivo);
+    }
+    registrarVazao(state, instancia->getBacklog());
+}
+
+void BM_CalcularValorObjetivo(benchmark::State& state, InstanciaPtr instancia) {
+    Solucao inicial = solucaoDePartida(instancia);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(calcularValorObjetivo(instancia->getDeposito(), instancia->getBacklog(), inicial));
+    }
+    registrarVazao(state, instancia->getBacklog());
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    // Extrair --instancias antes de repassar os demais argumentos ao Google Benchmark
+    std::string diretorio = DIRETORIO_INSTANCIAS_PADRAO;
+    std::vector<char*> argumentos;
+    for (int i = 0; i < argc; i++) {
+        if (std::strcmp(argv[i], "--instancias") == 0 && i + 1 < argc) {
+            diretorio = argv[++i];
+        } else {
+            argumentos.push_back(argv[i]);
+        }
+    }
+    int numArgumentos = static_cast<int>(argumentos.size());
+
+    std::vector<std::filesystem::path> arquivos;
+    if (std::filesystem::is_directory(diretorio)) {
+        for (const auto& entry : std::filesystem::directory_iterator(diretorio)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".txt") {
+                arquivos.push_back(entry.path());
+            }
+        }
+    }
+    std::sort(arquivos.begin(), arquivos.end());
+    if (arquivos.empty()) {
+        std::cerr << "Nenhuma instância encontrada em " << diretorio << "\n";
+        return 1;
+    }
+
+    for (const auto& arquivo : arquivos) {
+        InstanciaPtr instancia = Instancia::carregar(arquivo.string());
+        std::string nome = arquivo.stem().string();
+        benchmark::RegisterBenchmark(("ParseFile/" + nome).c_str(), BM_ParseFile, arquivo.string(), instancia);
+        benchmark::RegisterBenchmark(("LocalizadorItens::construir/" + nome).c_str(), BM_LocalizadorConstruir, instancia);
+        benchmark::RegisterBenchmark(("VerificadorDisponibilidade::construir/" + nome).c_str(), BM_VerificadorConstruir, instancia);
+        benchmark::RegisterBenchmark(("AnalisadorRelevancia::construir/" + nome).c_str(), BM_AnalisadorConstruir, instancia);
+        benchmark::RegisterBenchmark(("gerarSolucaoInicial/" + nome).c_str(), BM_GerarSolucaoInicial, instancia);
+        benchmark::RegisterBenchmark(("perturbarSolucao/" + nome).c_str(), BM_PerturbarSolucao, instancia);
+        benchmark::RegisterBenchmark(("perturbarSolucao(area)/" + nome).c_str(), BM_PerturbarSolucaoArea, instancia);
+        benchmark::RegisterBenchmark(("ajustarSolucao/" + nome).c_str(), BM_AjustarSolucao, instancia);
+        benchmark::RegisterBenchmark(("calcularValorObjetivo/" + nome).c_str(), BM_CalcularValorObjetivo, instancia);
+    }
+
+    benchmark::Initialize(&numArgumentos, argumentos.data());
+    if (benchmark::ReportUnrecognizedArguments(numArgumentos, argumentos.data())) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -71,6 +71,7 @@ show_help() {
     echo -e "  ${YELLOW}limpar${NC}        - Remove o diretório build antes de compilar"
     echo -e "  ${YELLOW}testar${NC}        - Executa os testes após a compilação"
     echo -e "  ${YELLOW}executar${NC}      - Executa o programa principal após a compilação"
+    echo -e "  ${YELLOW}benchmark${NC}     - Executa os micro-benchmarks dos kernels após a compilação"
     echo -e "  ${YELLOW}ajuda${NC}         - Mostra esta mensagem de ajuda"
     echo -e "  ${YELLOW}paralelo=N${NC}    - Define o nível de paralelismo para a compilação (0 = auto-detectar)"
     echo -e "  ${YELLOW}relatorio${NC}     - Gera um relatório do projeto após a compilação"
@@ -88,6 +89,7 @@ show_help() {
 CLEAN=0
 RUN_TESTS=0
 RUN_EXECUTABLE=0
+RUN_BENCHMARKS=0
 GENERATE_REPORT=0
 INSTALL_PROGRAM=0
 
@@ -104,6 +106,9 @@ do
         executar)
             RUN_EXECUTABLE=1
             ;;
+        benchmark)
+            RUN_BENCHMARKS=1
+            ;;
         ajuda)
             show_banner
             show_help
@@ -249,6 +254,20 @@ run_executable() {
     fi
 }
 
+# Executar os micro-benchmarks
+run_benchmarks() {
+    if [ $RUN_BENCHMARKS -eq 1 ]; then
+        print_msg "Executando benchmarks..." "${YELLOW}"
+        cd "$BUILD_DIR"
+        
+        if [ -f "./benchmark_kernels" ]; then
+            ./benchmark_kernels
+        else
+            print_msg "Executável 'benchmark_kernels' não encontrado (Google Benchmark instalado?)." "${RED}"
+        fi
+    fi
+}
+
 # Gerar relatório do projeto
 generate_report() {
     if [ $GENERATE_REPORT -eq 1 ]; then
@@ -384,6 +403,7 @@ main() {
     build_project
     run_tests
     run_executable
+    run_benchmarks
     generate_report
     install_program
     
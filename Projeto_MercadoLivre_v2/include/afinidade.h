@@ -0,0 +1,39 @@
+#pragma once
+
+#include <vector>
+
+/**
+ * Topologia NUMA e fixação de threads em CPUs (Linux).
+ *
+ * Sem libnuma: os nós e suas CPUs vêm de /sys/devices/system/node, restritos às CPUs
+ * permitidas ao processo. A memória segue a política padrão do kernel (primeiro toque):
+ * páginas ficam no nó da thread que as escreve primeiro, por isso basta que a leitura e a
+ * construção das estruturas de uma instância rodem em threads fixadas no nó de destino.
+ * Em outros sistemas, ou sem sysfs, a topologia tem um único nó e a fixação não faz nada.
+ */
+
+/**
+ * @brief CPUs de cada nó NUMA utilizáveis pelo processo
+ */
+struct TopologiaNuma {
+    std::vector<std::vector<int>> cpusPorNo; // Nós sem CPUs permitidas são omitidos
+
+    /**
+     * @brief Lê a topologia do sistema
+     * @param maxNos Limite de nós usados (0 = todos); os nós excedentes são descartados
+     * @return Topologia com ao menos um nó (todas as CPUs permitidas, se sysfs não estiver disponível)
+     */
+    static TopologiaNuma detectar(int maxNos = 0);
+};
+
+/**
+ * @brief CPUs em que a thread corrente pode executar
+ */
+std::vector<int> cpusDaThread();
+
+/**
+ * @brief Restringe a thread corrente a um conjunto de CPUs (threads criadas depois herdam a máscara)
+ * @param cpus IDs das CPUs (vazio = não altera)
+ * @return true se a máscara foi aplicada
+ */
+bool fixarThreadEmCpus(const std::vector<int>& cpus);
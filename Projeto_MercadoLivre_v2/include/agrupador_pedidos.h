@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include "armazem.h"
+#include "localizador_itens.h"
+
+/**
+ * @brief Estrutura para agrupamento de pedidos que compartilham corredores (MinHash/LSH)
+ *
+ * Cada pedido é representado pelo conjunto de corredores que ele visita. As assinaturas
+ * MinHash estimam a similaridade de Jaccard entre esses conjuntos e o LSH por bandas
+ * coloca pedidos parecidos no mesmo balde sem comparar todos os pares.
+ */
+struct AgrupadorPedidos {
+    static constexpr int NUM_HASHES = 32;           // Tamanho da assinatura MinHash
+    static constexpr int LINHAS_POR_BANDA = 4;      // Linhas por banda do LSH
+    static constexpr int NUM_BANDAS = NUM_HASHES / LINHAS_POR_BANDA;
+    
+    std::vector<uint32_t> assinaturas;     // assinaturas[pedidoId * NUM_HASHES + h]
+    std::vector<int> clusterDoPedido;      // pedidoId -> índice do cluster (-1 se sem corredores)
+    std::vector<std::vector<int>> clusters; // Clusters ordenados do maior para o menor
+    
+    /**
+     * @brief Construtor
+     * @param numPedidos Número total de pedidos no backlog
+     */
+    AgrupadorPedidos(int numPedidos)
+        : assinaturas(static_cast<size_t>(numPedidos) * NUM_HASHES), clusterDoPedido(numPedidos, -1) {}
+    
+    /**
+     * @brief Calcula as assinaturas e agrupa os pedidos similares
+     * @param backlog Referência ao objeto Backlog
+     * @param localizador Referência ao objeto LocalizadorItens
+     * @param similaridadeMinima Similaridade estimada mínima para unir dois pedidos de um mesmo balde
+     */
+    void construir(const Backlog& backlog, const LocalizadorItens& localizador,
+                   double similaridadeMinima = 0.5);
+    
+    /**
+     * @brief Estima a similaridade de Jaccard entre os corredores de dois pedidos
+     * @param pedidoA ID do primeiro pedido
+     * @param pedidoB ID do segundo pedido
+     * @return Fração de posições iguais nas assinaturas (entre 0 e 1)
+     */
+    double similaridadeEstimada(int pedidoA, int pedidoB) const;
+};
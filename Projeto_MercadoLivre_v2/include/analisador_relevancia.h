@@ -1,17 +1,22 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <mutex>
 #include <vector>
-#include <unordered_set>
-#include <algorithm>
 #include "armazem.h"
 #include "localizador_itens.h"
 
 /**
  * @brief Estrutura para análise e ordenação de pedidos por relevância
+ *
+ * Os dados de pontuação ficam em estrutura de vetores (um vetor por campo, indexado
+ * pelo ID do pedido). A ordenação por relevância é calculada sob demanda e mantida em
+ * cache até que invalidarRanking() seja chamado.
  */
 struct AnalisadorRelevancia {
     /**
-     * @brief Estrutura para armazenar informações de relevância de um pedido
+     * @brief Estrutura para consultar as informações de relevância de um pedido
      */
     struct InfoPedido {
         int pedidoId;
@@ -21,74 +26,88 @@ struct AnalisadorRelevancia {
         double pontuacaoRelevancia; // Pontuação calculada de relevância
     };
     
-    std::vector<InfoPedido> infoPedidos;
+    std::vector<int> numItens;              // pedidoId -> tipos de itens diferentes
+    std::vector<int> numUnidades;           // pedidoId -> total de unidades
+    std::vector<int> numCorredoresMinimo;   // pedidoId -> corredores necessários
+    std::vector<double> pontuacaoRelevancia; // pedidoId -> pontuação de relevância
+    std::vector<char> ativo;                 // pedidoId -> 1 se o pedido ainda está no backlog
     
     /**
      * @brief Construtor
      * @param numPedidos Número total de pedidos no backlog
      */
-    AnalisadorRelevancia(int numPedidos) : infoPedidos(numPedidos) {}
+    AnalisadorRelevancia(int numPedidos)
+        : numItens(numPedidos, 0), numUnidades(numPedidos, 0),
+          numCorredoresMinimo(numPedidos, 0), pontuacaoRelevancia(numPedidos, 0.0), ativo(numPedidos, 1) {}
     
     /**
      * @brief Inicializa a estrutura a partir do backlog e do localizador de itens
      * @param backlog Referência ao objeto Backlog
      * @param localizador Referência ao objeto LocalizadorItens
+     * @param numThreads Número de threads (0 = hardware_concurrency)
      */
-    void construir(const Backlog& backlog, const LocalizadorItens& localizador) {
-        for (int pedidoId = 0; pedidoId < backlog.numPedidos; pedidoId++) {
-            InfoPedido& info = infoPedidos[pedidoId];
-            info.pedidoId = pedidoId;
-            info.numItens = backlog.pedido[pedidoId].size();
-            
-            // Calcular número total de unidades
-            info.numUnidades = 0;
-            for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
-                info.numUnidades += quantidade;
-            }
-            
-            // Calcular número mínimo de corredores necessários
-            std::unordered_set<int> corredoresNecessarios;
-            for (const auto& [itemId, quantidadeSolicitada] : backlog.pedido[pedidoId]) {
-                const auto& corredoresComItem = localizador.getCorredoresComItem(itemId);
-                
-                int quantidadeRestante = quantidadeSolicitada;
-                // Ordenar corredores por quantidade disponível (decrescente)
-                std::vector<std::pair<int, int>> corredoresOrdenados(
-                    corredoresComItem.begin(), corredoresComItem.end());
-                std::sort(corredoresOrdenados.begin(), corredoresOrdenados.end(),
-                    [](const auto& a, const auto& b) { return a.second > b.second; });
-                
-                for (const auto& [corredorId, quantidadeDisponivel] : corredoresOrdenados) {
-                    if (quantidadeRestante <= 0) break;
-                    
-                    corredoresNecessarios.insert(corredorId);
-                    quantidadeRestante -= std::min(quantidadeRestante, quantidadeDisponivel);
-                }
-            }
-            
-            info.numCorredoresMinimo = corredoresNecessarios.size();
-            
-            // Calcular pontuação de relevância (mais itens, menos corredores = melhor)
-            info.pontuacaoRelevancia = (info.numItens * info.numUnidades) / 
-                                      (double)std::max(1, info.numCorredoresMinimo);
-        }
-    }
+    void construir(const Backlog& backlog, const LocalizadorItens& localizador, unsigned int numThreads = 0);
+    
+    /**
+     * @brief Obtém as informações de relevância de um pedido
+     * @param pedidoId ID do pedido
+     * @return Estrutura InfoPedido preenchida
+     */
+    InfoPedido getInfoPedido(int pedidoId) const;
+    
+    /**
+     * @brief Recalcula a pontuação de um subconjunto de pedidos (por exemplo, após mudanças no estoque)
+     * @param backlog Referência ao objeto Backlog
+     * @param localizador Referência ao objeto LocalizadorItens já atualizado
+     * @param pedidos IDs dos pedidos a reavaliar
+     */
+    void reavaliarPedidos(const Backlog& backlog, const LocalizadorItens& localizador,
+                          const std::vector<int>& pedidos);
+    
+    /**
+     * @brief Avalia um pedido recém-acrescentado ao final do backlog (custo O(itens do pedido))
+     * @param backlog Backlog que já contém o pedido na posição numItens.size()
+     * @param localizador Referência ao objeto LocalizadorItens
+     * @return ID do pedido avaliado
+     */
+    int adicionarPedido(const Backlog& backlog, const LocalizadorItens& localizador);
     
     /**
-     * @brief Obtém pedidos ordenados por relevância (do mais relevante para o menos)
-     * @return Vetor de IDs de pedidos ordenados por relevância
+     * @brief Retira um pedido do ranking (pedido atendido ou cancelado)
+     * @param pedidoId ID do pedido
      */
-    std::vector<int> getPedidosOrdenadosPorRelevancia() const {
-        std::vector<int> pedidosOrdenados(infoPedidos.size());
-        for (int i = 0; i < infoPedidos.size(); i++) {
-            pedidosOrdenados[i] = i;
-        }
-        
-        std::sort(pedidosOrdenados.begin(), pedidosOrdenados.end(),
-            [this](int a, int b) {
-                return infoPedidos[a].pontuacaoRelevancia > infoPedidos[b].pontuacaoRelevancia;
-            });
-        
-        return pedidosOrdenados;
+    void removerPedido(int pedidoId);
+    
+    /**
+     * @brief Obtém os pedidos ativos ordenados por relevância (do mais relevante para o menos)
+     * @return Referência ao ranking em cache (válida até a próxima invalidação)
+     */
+    const std::vector<int>& getPedidosOrdenadosPorRelevancia() const;
+    
+    /**
+     * @brief Obtém os k pedidos mais relevantes sem ordenar o backlog inteiro
+     * @param k Número de pedidos desejados
+     * @return Vetor com até k IDs de pedidos ativos, do mais relevante para o menos
+     */
+    std::vector<int> getPedidosMaisRelevantes(size_t k) const;
+    
+    /**
+     * @brief Descarta o ranking em cache (chamar após alterar as pontuações)
+     */
+    void invalidarRanking();
+    
+private:
+    // Calcula os campos de relevância de um pedido; marcador é um vetor de trabalho por corredor
+    void avaliarPedido(const Backlog& backlog, const LocalizadorItens& localizador,
+                       int pedidoId, std::vector<int>& marcador);
+    
+    // Compara dois pedidos por relevância (decrescente), desempatando pelo ID
+    bool maisRelevante(int a, int b) const {
+        return pontuacaoRelevancia[a] != pontuacaoRelevancia[b] ? 
+               pontuacaoRelevancia[a] > pontuacaoRelevancia[b] : a < b;
     }
-};
\ No newline at end of file
+    
+    mutable std::mutex mutexRanking;
+    mutable std::atomic<bool> rankingValido{false};
+    mutable std::vector<int> ranking;
+};
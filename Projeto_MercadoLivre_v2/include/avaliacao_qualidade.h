@@ -0,0 +1,73 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "solucionar_desafio.h"
+
+/**
+ * @brief Ponto da curva objetivo x tempo (uma nova incumbente)
+ */
+struct PontoCurva {
+    double tempo;    // Segundos desde o início da resolução
+    double objetivo; // Valor da incumbente reparada
+};
+
+/**
+ * @brief Resultado da avaliação de qualidade de uma instância
+ */
+struct ResultadoQualidade {
+    std::string instancia;
+    unsigned int numThreads = 0;
+    std::vector<PontoCurva> curva;
+    std::vector<double> objetivoNosTempos; // Melhor objetivo em cada tempo de corte
+    double objetivoFinal = 0.0;
+    double limitanteSuperior = 0.0;
+    double gap = 0.0;                      // (limitante - objetivo) / limitante
+    double tempoTotal = 0.0;               // Segundos
+    long memoriaPicoKB = 0;                // Pico de memória residente durante a instância
+    bool valida = false;
+    std::string erro;
+};
+
+/**
+ * @brief Tolerâncias da comparação com a linha de base
+ */
+struct ToleranciasQualidade {
+    double objetivo = 0.02; // Queda relativa máxima do objetivo final
+    double tempo = 0.0;     // Razão máxima de tempo (atual / base); 0 = não comparar
+    double memoria = 0.0;   // Razão máxima de memória (atual / base); 0 = não comparar
+};
+
+/**
+ * @brief Resolve uma instância registrando a curva objetivo x tempo, o gap e o pico de memória
+ * @param arquivoInstancia Caminho do arquivo de instância
+ * @param configuracao Configuração do solver (o tempo limite deve cobrir o maior tempo de corte)
+ * @param temposCorte Tempos, em segundos, nos quais o objetivo é amostrado
+ * @return ResultadoQualidade Resultado da instância
+ */
+ResultadoQualidade avaliarInstancia(const std::string& arquivoInstancia, const ConfiguracaoSolver& configuracao,
+                                    const std::vector<double>& temposCorte);
+
+/**
+ * @brief Escreve os resultados em CSV (uma linha por instância; colunas objetivo_<t>s por tempo de corte)
+ */
+void escreverQualidadeCsv(const std::vector<ResultadoQualidade>& resultados, const std::vector<double>& temposCorte,
+                          std::ostream& saida);
+
+/**
+ * @brief Escreve os resultados em JSON, incluindo a curva completa de cada instância
+ */
+void escreverQualidadeJson(const std::vector<ResultadoQualidade>& resultados, const std::vector<double>& temposCorte,
+                           std::ostream& saida);
+
+/**
+ * @brief Compara os resultados com uma linha de base em CSV (formato de escreverQualidadeCsv)
+ * @param resultados Resultados da execução atual
+ * @param arquivoBase Caminho do CSV da linha de base
+ * @param tolerancias Tolerâncias de objetivo, tempo e memória
+ * @param relatorio Fluxo onde cada regressão é descrita
+ * @return Número de regressões encontradas (pares instância/threads ausentes da base são ignorados)
+ */
+int compararComBase(const std::vector<ResultadoQualidade>& resultados, const std::string& arquivoBase,
+                    const ToleranciasQualidade& tolerancias, std::ostream& relatorio);
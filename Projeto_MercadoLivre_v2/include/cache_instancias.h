@@ -0,0 +1,59 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "instancia.h"
+#include "solucionar_desafio.h"
+
+/**
+ * @brief Cache de instâncias carregadas, indexado pelo caminho do arquivo
+ *
+ * Cada entrada guarda a instância imutável (com as estruturas auxiliares construídas
+ * sob demanda) e a última solução devolvida, usada como ponto de partida da próxima.
+ * É compartilhado pelo servidor, pela resolução em lote e pela validação, para que cada
+ * arquivo seja interpretado uma única vez.
+ */
+class CacheInstancias {
+public:
+    struct Entrada {
+        InstanciaPtr instancia;
+        std::shared_ptr<const Solucao> ultimaSolucao;
+    };
+
+    /**
+     * @brief Obtém a entrada de uma instância, carregando-a do disco na primeira vez
+     * @param caminho Caminho do arquivo de instância
+     * @param numThreads Threads para as estruturas auxiliares, se a instância for carregada agora
+     */
+    Entrada obter(const std::string& caminho, unsigned int numThreads = 0);
+
+    /**
+     * @brief Substitui a instância de uma entrada pelo resultado de uma transformação da atual
+     *
+     * Alterações de uma mesma entrada são serializadas: cada transformação recebe a instância
+     * deixada pela anterior, de modo que alterações concorrentes não se perdem. Leituras (obter)
+     * não esperam pela transformação. A última solução é mantida para a partida a quente; as
+     * estruturas auxiliares da nova instância são reconstruídas no primeiro acesso a ela.
+     *
+     * @param caminho Caminho do arquivo de instância
+     * @param transformar Recebe a instância atual e devolve a nova
+     * @return InstanciaPtr Instância resultante
+     */
+    InstanciaPtr modificar(const std::string& caminho,
+                           const std::function<InstanciaPtr(const Instancia&)>& transformar);
+
+    /**
+     * @brief Registra a última solução devolvida para uma instância
+     */
+    void registrarSolucao(const std::string& caminho, const Solucao& solucao);
+
+private:
+    std::shared_ptr<std::mutex> obterMutexAlteracao(const std::string& caminho);
+
+    std::mutex mutex;
+    std::unordered_map<std::string, Entrada> entradas;
+    std::unordered_map<std::string, std::shared_ptr<std::mutex>> mutexesAlteracao;
+};
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Conjunto indexado de IDs de pedidos de uma wave
+ *
+ * Combina o vetor de IDs (formato de saída) com um índice de posições e um mapa de bits
+ * de pertinência, permitindo contem/inserir/remover em O(1). A remoção troca o elemento
+ * removido pelo último do vetor, portanto a ordem dos IDs não é preservada.
+ *
+ * Cópias compartilham os dados até a primeira modificação (copy-on-write), o que torna
+ * barato distribuir a solução corrente entre threads.
+ */
+class ConjuntoPedidos {
+public:
+    using const_iterator = std::vector<int>::const_iterator;
+    
+    ConjuntoPedidos() : dados(std::make_shared<Dados>()) {}
+    
+    /**
+     * @brief Constrói o conjunto a partir de um vetor de IDs (repetições são ignoradas)
+     * @param pedidosIds IDs dos pedidos
+     */
+    explicit ConjuntoPedidos(const std::vector<int>& pedidosIds) : ConjuntoPedidos() {
+        for (int pedidoId : pedidosIds) {
+            inserir(pedidoId);
+        }
+    }
+    
+    /**
+     * @brief Verifica se um pedido pertence ao conjunto
+     * @param pedidoId ID do pedido
+     * @return true se o pedido pertence ao conjunto
+     */
+    bool contem(int pedidoId) const {
+        const auto& bits = dados->bits;
+        size_t palavra = static_cast<size_t>(pedidoId) >> 6;
+        return palavra < bits.size() && ((bits[palavra] >> (pedidoId & 63)) & 1ULL);
+    }
+    
+    /**
+     * @brief Insere um pedido no final do conjunto
+     * @param pedidoId ID do pedido
+     * @return true se o pedido foi inserido, false se já pertencia ao conjunto
+     */
+    bool inserir(int pedidoId) {
+        if (contem(pedidoId)) return false;
+        
+        Dados& d = paraEscrita();
+        size_t indice = static_cast<size_t>(pedidoId);
+        if (indice >= d.posicao.size()) {
+            size_t novoTamanho = std::max(indice + 1, d.posicao.size() * 2);
+            d.posicao.resize(novoTamanho, -1);
+            d.bits.resize((novoTamanho + 63) / 64, 0);
+        }
+        
+        d.posicao[indice] = static_cast<int>(d.ids.size());
+        d.bits[indice >> 6] |= (1ULL << (pedidoId & 63));
+        d.ids.push_back(pedidoId);
+        return true;
+    }
+    
+    /**
+     * @brief Remove um pedido do conjunto (troca com o último elemento)
+     * @param pedidoId ID do pedido
+     * @return true se o pedido foi removido, false se não pertencia ao conjunto
+     */
+    bool remover(int pedidoId) {
+        if (!contem(pedidoId)) return false;
+        removerNaPosicao(static_cast<size_t>(dados->posicao[pedidoId]));
+        return true;
+    }
+    
+    /**
+     * @brief Remove o pedido que ocupa uma posição do vetor de IDs
+     * @param posicao Posição no vetor de IDs (0 <= posicao < size())
+     */
+    void removerNaPosicao(size_t posicao) {
+        Dados& d = paraEscrita();
+        int pedidoId = d.ids[posicao];
+        int ultimo = d.ids.back();
+        
+        d.ids[posicao] = ultimo;
+        d.posicao[ultimo] = static_cast<int>(posicao);
+        d.ids.pop_back();
+        
+        d.posicao[pedidoId] = -1;
+        d.bits[static_cast<size_t>(pedidoId) >> 6] &= ~(1ULL << (pedidoId & 63));
+    }
+    
+    /**
+     * @brief Remove todos os pedidos
+     */
+    void limpar() {
+        Dados& d = paraEscrita();
+        for (int pedidoId : d.ids) {
+            d.posicao[pedidoId] = -1;
+            d.bits[static_cast<size_t>(pedidoId) >> 6] = 0;
+        }
+        d.ids.clear();
+    }
+    
+    /**
+     * @brief Copia o conteúdo de outro conjunto reaproveitando os vetores deste, quando exclusivos
+     * @param outro Conjunto de origem
+     */
+    void atribuir(const ConjuntoPedidos& outro) {
+        if (dados == outro.dados) return;
+        if (dados.use_count() > 1) {
+            dados = std::make_shared<Dados>(*outro.dados);
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        *dados = *outro.dados;
+    }
+    
+    /**
+     * @brief Obtém os IDs no formato de saída
+     * @return Referência constante ao vetor de IDs
+     */
+    const std::vector<int>& ids() const { return dados->ids; }
+    
+    size_t size() const { return dados->ids.size(); }
+    bool empty() const { return dados->ids.empty(); }
+    int operator[](size_t posicao) const { return dados->ids[posicao]; }
+    
+    /**
+     * @brief Bytes reservados pelos vetores internos (dados compartilhados contam em cada cópia)
+     */
+    size_t bytesAlocados() const {
+        return dados->ids.capacity() * sizeof(int) + dados->posicao.capacity() * sizeof(int) +
+               dados->bits.capacity() * sizeof(uint64_t);
+    }
+    const_iterator begin() const { return dados->ids.begin(); }
+    const_iterator end() const { return dados->ids.end(); }
+    
+private:
+    struct Dados {
+        std::vector<int> ids;          // IDs na ordem de inserção (com trocas na remoção)
+        std::vector<int> posicao;      // pedidoId -> posição em ids (-1 se ausente)
+        std::vector<uint64_t> bits;    // Mapa de bits de pertinência
+    };
+    
+    std::shared_ptr<Dados> dados;
+    
+    // Garante uma cópia exclusiva dos dados antes de modificá-los
+    Dados& paraEscrita() {
+        if (dados.use_count() > 1) {
+            dados = std::make_shared<Dados>(*dados);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return *dados;
+    }
+};
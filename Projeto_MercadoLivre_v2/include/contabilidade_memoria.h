@@ -0,0 +1,155 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+struct Deposito;
+struct Backlog;
+struct LocalizadorItens;
+struct VerificadorDisponibilidade;
+struct AnalisadorRelevancia;
+struct AgrupadorPedidos;
+struct Solucao;
+struct AreaTrabalhoBusca;
+
+/**
+ * Contabilidade de memória por estrutura, com uso atual e pico.
+ *
+ * Não intercepta alocações: cada estrutura é medida uma vez, pela capacidade dos seus
+ * contêineres, quando é construída (bytesEstimados), e o valor é lançado na conta da
+ * instância; os buffers da busca (soluções perturbadas e áreas de trabalho de cada thread)
+ * são lançados enquanto existem e acompanham o crescimento dos vetores (ReservaMemoria). Cada conta repassa seus lançamentos à conta pai, e a conta global
+ * soma todas as instâncias, de modo que o pico global reflete instâncias resolvidas ao
+ * mesmo tempo. O custo é de algumas operações atômicas por estrutura e por perturbação.
+ */
+
+enum CategoriaMemoria {
+    MEMORIA_DEPOSITO,
+    MEMORIA_BACKLOG,
+    MEMORIA_LOCALIZADOR,
+    MEMORIA_VERIFICADOR,
+    MEMORIA_ANALISADOR,
+    MEMORIA_AGRUPADOR,
+    MEMORIA_SOLUCOES,
+    MEMORIA_AREA_TRABALHO,
+    NUM_CATEGORIAS_MEMORIA
+};
+
+/**
+ * @brief Uso atual e pico de uma conta, por categoria e no total (bytes)
+ */
+struct UsoMemoria {
+    uint64_t atual[NUM_CATEGORIAS_MEMORIA] = {};
+    uint64_t pico[NUM_CATEGORIAS_MEMORIA] = {};
+    uint64_t atualTotal = 0;
+    uint64_t picoTotal = 0;
+};
+
+class ContabilidadeMemoria {
+public:
+    /**
+     * @brief Construtor
+     * @param pai Conta que também recebe os lançamentos (nulo para a conta global)
+     */
+    explicit ContabilidadeMemoria(ContabilidadeMemoria* pai = &global());
+
+    /**
+     * @brief Ao ser destruída, a conta devolve à conta pai o que ainda estava lançado
+     */
+    ~ContabilidadeMemoria();
+
+    ContabilidadeMemoria(const ContabilidadeMemoria&) = delete;
+    ContabilidadeMemoria& operator=(const ContabilidadeMemoria&) = delete;
+
+    /**
+     * @brief Conta que soma todas as instâncias do processo
+     */
+    static ContabilidadeMemoria& global();
+
+    /**
+     * @brief Conta vinculada à thread corrente (a global, se nenhuma)
+     */
+    static ContabilidadeMemoria& atual();
+
+    /**
+     * @brief Lança bytes alocados (positivo) ou liberados (negativo) numa categoria
+     */
+    void lancar(CategoriaMemoria categoria, int64_t bytes);
+
+    /**
+     * @brief Lê o uso atual e os picos
+     */
+    UsoMemoria ler() const;
+
+private:
+    ContabilidadeMemoria* pai;
+    std::atomic<int64_t> atualCategoria[NUM_CATEGORIAS_MEMORIA];
+    std::atomic<int64_t> picoCategoria[NUM_CATEGORIAS_MEMORIA];
+    std::atomic<int64_t> atualTotal{0};
+    std::atomic<int64_t> picoTotal{0};
+};
+
+/**
+ * @brief Vincula a thread corrente a uma conta durante o escopo (restaura a anterior ao sair)
+ */
+class VinculoMemoria {
+public:
+    explicit VinculoMemoria(ContabilidadeMemoria* conta);
+    ~VinculoMemoria();
+    VinculoMemoria(const VinculoMemoria&) = delete;
+    VinculoMemoria& operator=(const VinculoMemoria&) = delete;
+
+private:
+    ContabilidadeMemoria* anterior;
+};
+
+/**
+ * @brief Lançamento de escopo na conta da thread corrente, estornado no destrutor
+ */
+class ReservaMemoria {
+public:
+    ReservaMemoria(CategoriaMemoria categoria, size_t bytes)
+        : conta(&ContabilidadeMemoria::atual()), categoria(categoria), bytes(static_cast<int64_t>(bytes)) {
+        conta->lancar(categoria, this->bytes);
+    }
+    ~ReservaMemoria() { conta->lancar(categoria, -bytes); }
+
+    /**
+     * @brief Atualiza o valor reservado (por exemplo, quando um buffer reaproveitado cresce)
+     */
+    void ajustar(size_t novosBytes) {
+        int64_t novos = static_cast<int64_t>(novosBytes);
+        if (novos == bytes) return;
+        conta->lancar(categoria, novos - bytes);
+        bytes = novos;
+    }
+    ReservaMemoria(const ReservaMemoria&) = delete;
+    ReservaMemoria& operator=(const ReservaMemoria&) = delete;
+
+private:
+    ContabilidadeMemoria* conta;
+    CategoriaMemoria categoria;
+    int64_t bytes;
+};
+
+/**
+ * @brief Estimativa dos bytes ocupados por uma estrutura (capacidade dos contêineres e nós)
+ */
+size_t bytesEstimados(const Deposito& deposito);
+size_t bytesEstimados(const Backlog& backlog);
+size_t bytesEstimados(const LocalizadorItens& localizador);
+size_t bytesEstimados(const VerificadorDisponibilidade& verificador);
+size_t bytesEstimados(const AnalisadorRelevancia& analisador);
+size_t bytesEstimados(const AgrupadorPedidos& agrupador);
+size_t bytesEstimados(const Solucao& solucao);
+size_t bytesEstimados(const AreaTrabalhoBusca& area);
+
+/**
+ * @brief Escreve o uso de uma conta como objeto JSON (bytes)
+ * @param saida Fluxo de saída
+ * @param uso Uso lido com ContabilidadeMemoria::ler
+ */
+void escreverUsoMemoriaJson(std::ostream& saida, const UsoMemoria& uso);
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+/**
+ * Contadores de hardware (perf_event_open) da thread corrente.
+ *
+ * Os eventos são abertos como um grupo na primeira leitura da thread e lidos juntos com uma
+ * única chamada read(); quando o kernel multiplexa o grupo, os valores são escalados pelo
+ * tempo em que ele esteve ativo. Sem suporte (outro sistema, perf_event_paranoid restritivo,
+ * contêiner sem PMU), disponivel() retorna false e as leituras ficam zeradas.
+ */
+
+enum EventoHardware {
+    EVENTO_CICLOS,
+    EVENTO_INSTRUCOES,
+    EVENTO_FALHAS_CACHE,
+    EVENTO_FALHAS_DESVIO,
+    NUM_EVENTOS_HARDWARE
+};
+
+/**
+ * @brief Valores acumulados dos eventos desde a abertura do grupo
+ */
+struct LeituraHardware {
+    uint64_t valor[NUM_EVENTOS_HARDWARE] = {};
+};
+
+class ContadoresHardware {
+public:
+    /**
+     * @brief Grupo de contadores da thread corrente (aberto na primeira chamada)
+     */
+    static ContadoresHardware& daThread();
+
+    /**
+     * @brief Indica se ao menos um evento pôde ser aberto
+     */
+    bool disponivel() const { return fdLider >= 0; }
+
+    /**
+     * @brief Motivo da indisponibilidade (vazio quando disponível)
+     */
+    const std::string& motivo() const { return motivoIndisponivel; }
+
+    /**
+     * @brief Lê os eventos do grupo
+     * @param leitura Recebe os valores (eventos que não abriram ficam em zero)
+     * @return false se os contadores não estão disponíveis
+     */
+    bool ler(LeituraHardware& leitura) const;
+
+    ~ContadoresHardware();
+    ContadoresHardware(const ContadoresHardware&) = delete;
+    ContadoresHardware& operator=(const ContadoresHardware&) = delete;
+
+private:
+    ContadoresHardware();
+
+    int fdLider = -1;
+    int fds[NUM_EVENTOS_HARDWARE];
+    int posicaoNoGrupo[NUM_EVENTOS_HARDWARE]; // índice do evento na leitura do grupo (-1 = não aberto)
+    int numAbertos = 0;
+    std::string motivoIndisponivel;
+};
+
+/**
+ * @brief Nome do evento no JSON de métricas
+ */
+const char* nomeEventoHardware(EventoHardware evento);
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+/**
+ * @brief Fila bloqueante de capacidade limitada que liga os estágios do pipeline
+ *
+ * inserir() bloqueia enquanto a fila está cheia (o produtor não se adianta mais do que
+ * a capacidade) e retirar() bloqueia enquanto está vazia. Depois de fechar(), retirar()
+ * esvazia os elementos restantes e então devolve false.
+ */
+template <typename T>
+class FilaLimitada {
+public:
+    /**
+     * @brief Construtor
+     * @param capacidade Número máximo de elementos na fila (mínimo 1)
+     */
+    explicit FilaLimitada(size_t capacidade) : capacidade(capacidade > 0 ? capacidade : 1) {}
+
+    /**
+     * @brief Insere um elemento, aguardando espaço
+     * @return false se a fila foi fechada
+     */
+    bool inserir(T elemento) {
+        std::unique_lock<std::mutex> lock(mutex);
+        naoCheia.wait(lock, [this]() { return fechada || elementos.size() < capacidade; });
+        if (fechada) return false;
+        elementos.push_back(std::move(elemento));
+        naoVazia.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Retira o elemento mais antigo, aguardando até haver um
+     * @param elemento Recebe o elemento retirado
+     * @return false se a fila foi fechada e está vazia
+     */
+    bool retirar(T& elemento) {
+        std::unique_lock<std::mutex> lock(mutex);
+        naoVazia.wait(lock, [this]() { return fechada || !elementos.empty(); });
+        if (elementos.empty()) return false;
+        elemento = std::move(elementos.front());
+        elementos.pop_front();
+        naoCheia.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Fecha a fila: novas inserções falham e os consumidores terminam ao esvaziá-la
+     */
+    void fechar() {
+        std::lock_guard<std::mutex> lock(mutex);
+        fechada = true;
+        naoVazia.notify_all();
+        naoCheia.notify_all();
+    }
+
+private:
+    size_t capacidade;
+    std::deque<T> elementos;
+    std::mutex mutex;
+    std::condition_variable naoVazia;
+    std::condition_variable naoCheia;
+    bool fechada = false;
+};
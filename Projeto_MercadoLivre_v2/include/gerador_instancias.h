@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+/**
+ * @brief Parâmetros de uma instância sintética
+ */
+struct ParametrosGerador {
+    int numPedidos = 1000;
+    int numItens = 1000;
+    int numCorredores = 100;
+    double itensPorPedidoMedio = 3.0;       // Itens distintos por pedido (geométrica, mínimo 1)
+    int maxItensPorPedido = 50;
+    double quantidadeMedia = 1.5;           // Unidades por item do pedido (geométrica, mínimo 1)
+    double zipf = 1.0;                      // Expoente da popularidade dos itens (0 = uniforme)
+    double itensPorCorredorMedio = 30.0;    // Itens distintos por corredor (todo item aparece em algum)
+    double estoqueMedio = 5.0;              // Estoque de um item num corredor
+    std::string distribuicaoEstoque = "geometrica"; // "geometrica" ou "uniforme" (1 a 2 x média - 1)
+    int LB = -1;                            // -1 = metade do UB
+    int UB = -1;                            // -1 = fracaoUB x unidades do backlog
+    double fracaoUB = 0.01;
+    uint64_t semente = 1;
+};
+
+/**
+ * @brief Escreve uma instância sintética no formato texto do desafio
+ *
+ * A popularidade dos itens segue uma lei de Zipf sobre uma permutação aleatória dos IDs;
+ * os corredores recebem cada item ao menos uma vez e cópias adicionais na proporção da
+ * popularidade. O gerador pseudoaleatório e as distribuições são implementados aqui, de modo
+ * que a mesma semente produz o mesmo arquivo em qualquer plataforma. Os pedidos são escritos
+ * à medida que são gerados (memória proporcional a itens + corredores, não a pedidos).
+ *
+ * @param parametros Parâmetros da instância
+ * @param saida Fluxo de saída
+ */
+void gerarInstancia(const ParametrosGerador& parametros, std::ostream& saida);
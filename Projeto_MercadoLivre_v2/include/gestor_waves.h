@@ -1,6 +1,7 @@
 #pragma once
 
 #include "armazem.h"
+#include "instancia.h"
 #include "localizador_itens.h"
 #include "verificador_disponibilidade.h"
 #include "analisador_relevancia.h"
@@ -11,20 +12,15 @@
  */
 class GestorWaves {
 private:
-    Deposito deposito;
-    Backlog backlog;
-    LocalizadorItens localizador;
-    VerificadorDisponibilidade verificador;
-    AnalisadorRelevancia analisador;
+    InstanciaPtr instancia;
     SeletorWaves seletor;
     
 public:
     /**
      * @brief Construtor
-     * @param dep Referência ao objeto Deposito
-     * @param back Referência ao objeto Backlog
+     * @param inst Instância compartilhada (dados e estruturas auxiliares não são copiados)
      */
-    GestorWaves(const Deposito& dep, const Backlog& back);
+    explicit GestorWaves(InstanciaPtr inst);
     
     /**
      * @brief Seleciona a melhor wave possível
@@ -57,17 +53,17 @@ public:
      * @brief Obtém o LocalizadorItens
      * @return Referência constante ao objeto LocalizadorItens
      */
-    const LocalizadorItens& getLocalizador() const { return localizador; }
+    const LocalizadorItens& getLocalizador() const { return instancia->getLocalizador(); }
 
     /**
      * @brief Obtém o VerificadorDisponibilidade
      * @return Referência constante ao objeto VerificadorDisponibilidade
      */
-    const VerificadorDisponibilidade& getVerificador() const { return verificador; }
+    const VerificadorDisponibilidade& getVerificador() const { return instancia->getVerificador(); }
 
     /**
      * @brief Obtém o AnalisadorRelevancia
      * @return Referência constante ao objeto AnalisadorRelevancia
      */
-    const AnalisadorRelevancia& getAnalisador() const { return analisador; }
-};
\ No newline at end of file
+    const AnalisadorRelevancia& getAnalisador() const { return instancia->getAnalisador(); }
+};
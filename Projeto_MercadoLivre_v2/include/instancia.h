@@ -0,0 +1,94 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include "armazem.h"
+#include "localizador_itens.h"
+#include "verificador_disponibilidade.h"
+#include "analisador_relevancia.h"
+#include "agrupador_pedidos.h"
+#include "contabilidade_memoria.h"
+
+class Instancia;
+
+/**
+ * @brief Ponteiro compartilhado para uma instância imutável
+ */
+using InstanciaPtr = std::shared_ptr<const Instancia>;
+
+/**
+ * @brief Instância imutável e compartilhada entre componentes e threads
+ *
+ * Guarda os dados brutos (depósito e backlog) e constrói as estruturas auxiliares
+ * uma única vez, na primeira vez em que forem solicitadas. Todos os consumidores
+ * recebem referências constantes, sem cópias.
+ */
+class Instancia {
+public:
+    /**
+     * @brief Lê um arquivo de instância e cria o objeto compartilhado
+     * @param filePath Caminho para o arquivo de entrada
+     * @param numThreads Threads para construir as estruturas auxiliares (0 = hardware_concurrency)
+     * @return Ponteiro compartilhado para a instância carregada
+     */
+    static InstanciaPtr carregar(const std::string& filePath, unsigned int numThreads = 0);
+    
+    /**
+     * @brief Cria o objeto compartilhado a partir de dados já carregados
+     * @param deposito Dados do depósito (movidos para a instância)
+     * @param backlog Dados do backlog (movidos para a instância)
+     * @param numThreads Threads para construir as estruturas auxiliares (0 = hardware_concurrency)
+     * @return Ponteiro compartilhado para a instância
+     */
+    static InstanciaPtr criar(Deposito deposito, Backlog backlog, unsigned int numThreads = 0);
+    
+    const Deposito& getDeposito() const { return deposito; }
+    const Backlog& getBacklog() const { return backlog; }
+    unsigned int getNumThreads() const { return numThreads; }
+    
+    /**
+     * @brief Obtém o LocalizadorItens, construindo-o na primeira chamada
+     */
+    const LocalizadorItens& getLocalizador() const;
+    
+    /**
+     * @brief Obtém o VerificadorDisponibilidade, construindo-o na primeira chamada
+     */
+    const VerificadorDisponibilidade& getVerificador() const;
+    
+    /**
+     * @brief Obtém o AnalisadorRelevancia, construindo-o na primeira chamada
+     */
+    const AnalisadorRelevancia& getAnalisador() const;
+    
+    /**
+     * @brief Obtém o AgrupadorPedidos, construindo-o na primeira chamada
+     */
+    const AgrupadorPedidos& getAgrupador() const;
+    
+    /**
+     * @brief Conta de memória da instância (estruturas construídas e cópias de soluções lançadas nela)
+     */
+    ContabilidadeMemoria& getMemoria() const { return memoria; }
+    
+    Instancia(const Instancia&) = delete;
+    Instancia& operator=(const Instancia&) = delete;
+    
+private:
+    Instancia(Deposito dep, Backlog back, unsigned int numThreads);
+    
+    const Deposito deposito;
+    const Backlog backlog;
+    const unsigned int numThreads;
+    mutable ContabilidadeMemoria memoria;
+    
+    mutable std::once_flag flagLocalizador;
+    mutable std::once_flag flagVerificador;
+    mutable std::once_flag flagAnalisador;
+    mutable std::once_flag flagAgrupador;
+    mutable std::unique_ptr<LocalizadorItens> localizador;
+    mutable std::unique_ptr<VerificadorDisponibilidade> verificador;
+    mutable std::unique_ptr<AnalisadorRelevancia> analisador;
+    mutable std::unique_ptr<AgrupadorPedidos> agrupador;
+};
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+/**
+ * Instrumentação por fase e contadores de caminho quente, exportada por instância em JSON.
+ *
+ * Compilada apenas com -DMERCADOLIVRE_INSTRUMENTACAO (opção CMake de mesmo nome); sem ela as
+ * macros não geram código e as classes são vazias. Cada thread acumula num bloco próprio,
+ * obtido ao se vincular ao registro da instância (VinculoInstrumentacao), e os blocos só são
+ * somados na exportação. Os tempos das fases são inclusivos (uma fase aninhada em outra
+ * conta para as duas).
+ *
+ * Com -DMERCADOLIVRE_CONTADORES_HARDWARE, cada fase acumula também ciclos, instruções, falhas
+ * de cache e de desvio da thread (ver contadores_hardware.h); sem permissão para
+ * perf_event_open, o JSON indica a indisponibilidade e segue só com os tempos.
+ */
+
+enum FaseInstrumentada {
+    FASE_LEITURA,
+    FASE_INDICES,
+    FASE_RELEVANCIA,
+    FASE_CONSTRUCAO,
+    FASE_OTIMIZACAO,
+    FASE_AJUSTE,
+    FASE_ESCRITA,
+    NUM_FASES
+};
+
+enum ContadorInstrumentado {
+    CONTADOR_PERTURBACOES,
+    CONTADOR_MOVIMENTOS_AVALIADOS,
+    CONTADOR_RECONSTRUCOES_CORREDORES,
+    CONTADOR_MELHORIAS,
+    NUM_CONTADORES
+};
+
+#ifdef MERCADOLIVRE_INSTRUMENTACAO
+
+#include <chrono>
+#include <deque>
+#include "contadores_hardware.h"
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+constexpr bool INSTRUMENTACAO_HABILITADA = true;
+
+/**
+ * @brief Métricas acumuladas por uma thread
+ */
+struct BlocoMetricas {
+    uint64_t tempoNs[NUM_FASES] = {};
+    uint64_t chamadas[NUM_FASES] = {};
+    uint64_t contadores[NUM_CONTADORES] = {};
+    uint64_t hardware[NUM_FASES][NUM_EVENTOS_HARDWARE] = {};
+    bool hardwareLido = false;
+    std::string motivoHardware; // por que os contadores desta thread não abriram (vazio se abriram)
+};
+
+// Bloco da thread corrente (nulo quando a thread não está vinculada a um registro)
+extern thread_local BlocoMetricas* blocoInstrumentacaoAtual;
+extern thread_local class RegistroInstrumentacao* registroInstrumentacaoAtual;
+
+/**
+ * @brief Métricas de uma instância: um bloco por thread que trabalhou nela
+ */
+class RegistroInstrumentacao {
+public:
+    /**
+     * @brief Registro ao qual a thread corrente está vinculada (nulo se nenhum)
+     */
+    static RegistroInstrumentacao* atual() { return registroInstrumentacaoAtual; }
+
+    /**
+     * @brief Bloco da thread corrente neste registro (criado na primeira chamada da thread)
+     */
+    BlocoMetricas* blocoDaThread();
+
+    /**
+     * @brief Escreve as fases e contadores somados de todas as threads
+     * @param saida Fluxo de saída
+     * @param instancia Nome da instância
+     */
+    void escreverJson(std::ostream& saida, const std::string& instancia) const;
+
+private:
+    mutable std::mutex mutex;
+    std::deque<BlocoMetricas> blocos;
+    std::unordered_map<std::thread::id, BlocoMetricas*> blocoPorThread;
+};
+
+/**
+ * @brief Vincula a thread corrente a um registro durante o escopo (restaura o anterior ao sair)
+ */
+class VinculoInstrumentacao {
+public:
+    explicit VinculoInstrumentacao(RegistroInstrumentacao* registro)
+        : registroAnterior(registroInstrumentacaoAtual), blocoAnterior(blocoInstrumentacaoAtual) {
+        registroInstrumentacaoAtual = registro;
+        blocoInstrumentacaoAtual = registro ? registro->blocoDaThread() : nullptr;
+    }
+    ~VinculoInstrumentacao() {
+        registroInstrumentacaoAtual = registroAnterior;
+        blocoInstrumentacaoAtual = blocoAnterior;
+    }
+    VinculoInstrumentacao(const VinculoInstrumentacao&) = delete;
+    VinculoInstrumentacao& operator=(const VinculoInstrumentacao&) = delete;
+
+private:
+    RegistroInstrumentacao* registroAnterior;
+    BlocoMetricas* blocoAnterior;
+};
+
+/**
+ * @brief Cronômetro de escopo que soma a duração a uma fase
+ */
+class CronometroFase {
+public:
+    explicit CronometroFase(FaseInstrumentada fase) : fase(fase), bloco(blocoInstrumentacaoAtual) {
+        if (!bloco) return;
+#ifdef MERCADOLIVRE_CONTADORES_HARDWARE
+        hardwareInicial = ContadoresHardware::daThread().ler(leituraInicial);
+        if (!hardwareInicial && bloco->motivoHardware.empty()) {
+            bloco->motivoHardware = ContadoresHardware::daThread().motivo();
+        }
+#endif
+        inicio = std::chrono::steady_clock::now();
+    }
+    ~CronometroFase() {
+        if (!bloco) return;
+        bloco->tempoNs[fase] += static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - inicio).count());
+        bloco->chamadas[fase]++;
+#ifdef MERCADOLIVRE_CONTADORES_HARDWARE
+        LeituraHardware leituraFinal;
+        if (hardwareInicial && ContadoresHardware::daThread().ler(leituraFinal)) {
+            for (int e = 0; e < NUM_EVENTOS_HARDWARE; e++) {
+                bloco->hardware[fase][e] += leituraFinal.valor[e] - leituraInicial.valor[e];
+            }
+            bloco->hardwareLido = true;
+        }
+#endif
+    }
+    CronometroFase(const CronometroFase&) = delete;
+    CronometroFase& operator=(const CronometroFase&) = delete;
+
+private:
+    FaseInstrumentada fase;
+    BlocoMetricas* bloco;
+    std::chrono::steady_clock::time_point inicio;
+#ifdef MERCADOLIVRE_CONTADORES_HARDWARE
+    LeituraHardware leituraInicial;
+    bool hardwareInicial = false;
+#endif
+};
+
+#define INSTRUMENTAR_CONCATENAR_(a, b) a##b
+#define INSTRUMENTAR_CONCATENAR(a, b) INSTRUMENTAR_CONCATENAR_(a, b)
+#define INSTRUMENTAR_FASE(fase) CronometroFase INSTRUMENTAR_CONCATENAR(cronometroFase_, __LINE__)(fase)
+#define INSTRUMENTAR_CONTADOR(contador, quantidade) \
+    do { if (blocoInstrumentacaoAtual) blocoInstrumentacaoAtual->contadores[contador] += (quantidade); } while (0)
+
+#else
+
+constexpr bool INSTRUMENTACAO_HABILITADA = false;
+
+class RegistroInstrumentacao {
+public:
+    static RegistroInstrumentacao* atual() { return nullptr; }
+    void escreverJson(std::ostream&, const std::string&) const {}
+};
+
+class VinculoInstrumentacao {
+public:
+    explicit VinculoInstrumentacao(RegistroInstrumentacao*) {}
+};
+
+#define INSTRUMENTAR_FASE(fase) ((void)0)
+#define INSTRUMENTAR_CONTADOR(contador, quantidade) ((void)0)
+
+#endif
@@ -0,0 +1,14 @@
+#pragma once
+
+/**
+ * @brief Executa o solver em lote, sem menu, a partir dos argumentos da linha de comando
+ *
+ * Opções: --entrada <dir|arquivo> --saida <dir> --threads <n> --tempo <segundos>
+ *         --algoritmo <completo|guloso|janela> --semente <n> --iteracoes <n> --ajuda
+ * Imprime uma linha "RESULTADO ..." por instância.
+ *
+ * @param argc Número de argumentos
+ * @param argv Argumentos
+ * @return Código de saída (0 = todas as instâncias resolvidas, 1 = alguma falhou, 2 = argumentos inválidos)
+ */
+int executarLinhaComando(int argc, char* argv[]);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <map>
 #include <unordered_map>
 #include "armazem.h"
 
@@ -11,11 +12,25 @@ struct LocalizadorItens {
     // itemId -> {corredorId -> quantidade}
     std::vector<std::unordered_map<int, int>> itemParaCorredor;
     
+    // Formato CSR: corredores de cada item ordenados por quantidade (decrescente).
+    // Os corredores do item i ocupam as posições [inicioItem[i], inicioItem[i + 1]);
+    // corredores cujo estoque foi zerado ficam no fim do segmento com quantidade 0.
+    std::vector<int> inicioItem;
+    std::vector<int> corredorOrdenado;
+    std::vector<int> quantidadeOrdenada;
+    
+    // Formato CSR: itens de cada corredor, nas posições [inicioCorredor[c], inicioCorredor[c + 1])
+    std::vector<int> inicioCorredor;
+    std::vector<int> itemDoCorredor;
+    std::vector<int> quantidadeDoCorredor;
+    
+    int numCorredores = 0;
+    
     /**
      * @brief Construtor
      * @param numItens Número total de itens no depósito
      */
-    LocalizadorItens(int numItens) : itemParaCorredor(numItens) {}
+    LocalizadorItens(int numItens) : itemParaCorredor(numItens), inicioItem(numItens + 1, 0) {}
     
     /**
      * @brief Inicializa a estrutura a partir do depósito
@@ -29,4 +44,19 @@ struct LocalizadorItens {
      * @return Mapa de corredores e suas quantidades disponíveis
      */
     const std::unordered_map<int, int>& getCorredoresComItem(int itemId) const;
-};
\ No newline at end of file
+
+    /**
+     * @brief Obtém os corredores usados por um pedido isolado (maior estoque primeiro, por item)
+     * @param pedido Mapa de itens e quantidades solicitadas
+     * @return Vetor ordenado de IDs de corredores, sem repetições
+     */
+    std::vector<int> getCorredoresPedido(const std::map<int, int>& pedido) const;
+
+    /**
+     * @brief Atualiza no local o estoque de um item num corredor, mantendo os CSR ordenados
+     * @param corredorId ID do corredor
+     * @param itemId ID do item (deve existir no corredor desde a construção)
+     * @param novaQuantidade Nova quantidade (0 remove o corredor da lista do item)
+     */
+    void atualizarEstoque(int corredorId, int itemId, int novaQuantidade);
+};
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <vector>
+#include "armazem.h"
+#include "localizador_itens.h"
+
+/**
+ * @brief Oráculo incremental de viabilidade de uma wave frente a um conjunto de corredores
+ *
+ * No grafo de fluxo pedidos -> itens -> corredores, cada item forma uma componente
+ * independente: o fluxo máximo satura todas as demandas se e somente se, para cada item,
+ * a demanda dos pedidos da wave não excede a oferta dos corredores abertos. O oráculo
+ * mantém demanda e oferta por item e o número de itens em déficit, de modo que abrir ou
+ * fechar um corredor e incluir ou retirar um pedido custa O(tamanho do corredor/pedido).
+ */
+class OraculoViabilidade {
+public:
+    /**
+     * @brief Atribuição de parte da demanda de um item a um corredor
+     */
+    struct Atribuicao {
+        int corredorId;
+        int itemId;
+        int quantidade;
+    };
+    
+    /**
+     * @brief Construtor (wave vazia e todos os corredores fechados)
+     * @param deposito Referência ao objeto Deposito
+     * @param backlog Referência ao objeto Backlog
+     */
+    OraculoViabilidade(const Deposito& deposito, const Backlog& backlog);
+    
+    void adicionarPedido(int pedidoId);
+    void removerPedido(int pedidoId);
+    void abrirCorredor(int corredorId);
+    void fecharCorredor(int corredorId);
+    
+    /**
+     * @brief Indica se os corredores abertos atendem todos os pedidos da wave
+     */
+    bool viavel() const { return itensEmDeficit == 0; }
+    
+    /**
+     * @brief Verifica se um pedido cabe num estoque, somado à demanda atual da wave
+     * @param pedidoId ID do pedido
+     * @param estoque Estoque por item (por exemplo, VerificadorDisponibilidade::estoqueTotal)
+     * @return true se demanda + pedido <= estoque para todos os itens do pedido
+     */
+    bool cabeNoEstoque(int pedidoId, const std::vector<int>& estoque) const;
+    
+    /**
+     * @brief Verifica se um pedido cabe na oferta restante dos corredores abertos
+     * @param pedidoId ID do pedido
+     * @return true se demanda + pedido <= oferta para todos os itens do pedido
+     */
+    bool cabeNaOferta(int pedidoId) const { return cabeNoEstoque(pedidoId, oferta); }
+    
+    /**
+     * @brief Verifica se um corredor aberto pode ser fechado sem gerar déficit
+     * @param corredorId ID do corredor
+     */
+    bool podeFecharCorredor(int corredorId) const;
+    
+    /**
+     * @brief Abre corredores (maior estoque primeiro) até eliminar os déficits possíveis
+     * @param localizador Estrutura auxiliar com os corredores de cada item
+     * @return true se a wave ficou viável
+     */
+    bool completarCorredores(const LocalizadorItens& localizador);
+    
+    /**
+     * @brief Fecha corredores redundantes, dos que menos contribuem para os que mais contribuem
+     *
+     * Ao final nenhum corredor aberto pode ser fechado isoladamente sem tornar a wave inviável.
+     */
+    void reduzirCorredores();
+    
+    /**
+     * @brief Distribui a demanda de cada item entre os corredores abertos (maior estoque primeiro)
+     * @param localizador Estrutura auxiliar com os corredores de cada item
+     * @return Lista de atribuições corredor/item/quantidade
+     */
+    std::vector<Atribuicao> atribuirEstoque(const LocalizadorItens& localizador) const;
+    
+    /**
+     * @brief Obtém os corredores abertos em ordem crescente de ID
+     */
+    std::vector<int> getCorredoresAbertos() const;
+    
+    int getNumItensEmDeficit() const { return itensEmDeficit; }
+    
+private:
+    // Atualiza a contagem de déficits após alterar demanda ou oferta de um item
+    void atualizarItem(int itemId, int demandaAnterior, int ofertaAnterior);
+    
+    const Deposito& deposito;
+    const Backlog& backlog;
+    std::vector<int> demanda;          // itemId -> unidades pedidas pela wave
+    std::vector<int> oferta;           // itemId -> unidades nos corredores abertos
+    std::vector<char> pedidoNaWave;
+    std::vector<char> corredorAberto;
+    int itensEmDeficit = 0;
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <istream>
+#include <string>
+#include "armazem.h"
+#include "instancia.h"
+#include "solucionar_desafio.h"
+#include "validar_resultados.h"
+
+/**
+ * @brief Aplica um arquivo de alterações (delta) ao depósito e ao backlog
+ *
+ * Formato, uma alteração por linha (linhas vazias e iniciadas por '#' são ignoradas):
+ *   + k item1 qtd1 ... itemk qtdk   inclui um pedido novo (recebe o próximo ID livre)
+ *   - pedidoId                      cancela um pedido (o ID é mantido, com o pedido vazio)
+ *   E corredorId itemId quantidade  define o estoque de um item num corredor (0 remove)
+ *
+ * @param deposito Depósito a ser alterado
+ * @param backlog Backlog a ser alterado
+ * @param arquivoDelta Caminho para o arquivo de alterações
+ */
+void aplicarDelta(Deposito& deposito, Backlog& backlog, const std::string& arquivoDelta);
+
+/**
+ * @brief Aplica alterações lidas de um fluxo (mesmo formato do arquivo de alterações)
+ * @param deposito Depósito a ser alterado
+ * @param backlog Backlog a ser alterado
+ * @param file Fluxo com uma alteração por linha
+ */
+void aplicarDelta(Deposito& deposito, Backlog& backlog, std::istream& file);
+
+/**
+ * @brief Mapeia uma solução lida de arquivo para uma instância (possivelmente alterada)
+ *
+ * Pedidos e corredores são casados pelo ID; IDs inexistentes e pedidos cancelados são descartados.
+ * A solução resultante pode violar LB/UB ou o estoque e deve passar por ajustarSolucao.
+ *
+ * @param anterior Solução lida com lerArquivoSolucao
+ * @param deposito Dados do depósito
+ * @param backlog Dados do backlog
+ * @return Solucao Solução mapeada
+ */
+Solucao mapearSolucao(const SolucaoValidacao& anterior, const Deposito& deposito, const Backlog& backlog);
+
+/**
+ * @brief Repara uma solução anterior e continua a busca a partir dela
+ * @param instancia Instância atual
+ * @param anterior Solução mapeada para a instância atual
+ * @param maxIteracoes Número máximo de perturbações (uma fração da busca a frio)
+ * @param aoMelhorar Chamada com a solução reparada e a cada melhoria da melhor solução ajustada (opcional)
+ * @return Solucao Melhor solução encontrada
+ */
+Solucao reotimizarSolucao(const InstanciaPtr& instancia, const Solucao& anterior, int maxIteracoes = 25,
+                          const CallbackIncumbente& aoMelhorar = nullptr);
+
+/**
+ * @brief Reotimiza uma instância a partir de uma solução anterior e salva o resultado
+ * @param arquivoInstancia Caminho da instância (nova, ou a anterior quando há delta)
+ * @param arquivoSolucao Caminho do .sol anterior
+ * @param arquivoDelta Caminho do arquivo de alterações (vazio = nenhum)
+ * @param diretorioSaida Diretório onde o novo .sol será salvo
+ */
+void processarPartidaQuente(const std::string& arquivoInstancia, const std::string& arquivoSolucao,
+                            const std::string& arquivoDelta, const std::string& diretorioSaida);
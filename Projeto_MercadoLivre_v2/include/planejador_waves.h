@@ -0,0 +1,69 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "armazem.h"
+#include "instancia.h"
+#include "localizador_itens.h"
+#include "verificador_disponibilidade.h"
+#include "analisador_relevancia.h"
+#include "agrupador_pedidos.h"
+#include "solucionar_desafio.h"
+
+/**
+ * @brief Planejador de uma sequência de waves sobre o mesmo backlog
+ *
+ * Mantém cópias mutáveis do depósito e do backlog e as estruturas auxiliares construídas
+ * uma única vez. Após cada wave, o estoque consumido é descontado no local (depósito,
+ * LocalizadorItens e estoque total do VerificadorDisponibilidade), os pedidos atendidos
+ * saem do backlog e apenas os pedidos que compartilham itens com a wave são reavaliados.
+ * Os clusters do AgrupadorPedidos não são recalculados: servem apenas como sementes.
+ */
+class PlanejadorWaves {
+public:
+    /**
+     * @brief Construtor
+     * @param instancia Instância de partida (não é modificada)
+     */
+    explicit PlanejadorWaves(const InstanciaPtr& instancia);
+
+    /**
+     * @brief Resolve a próxima wave e consome o estoque e os pedidos correspondentes
+     * @param wave Recebe a wave resolvida
+     * @return true se uma wave viável (LB <= unidades <= UB) foi encontrada
+     */
+    bool proximaWave(Solucao& wave);
+
+    /**
+     * @brief Planeja waves até esgotar o backlog/estoque ou atingir o limite, salvando um .sol por wave
+     * @param diretorioSaida Diretório onde os arquivos <nome>_waveK.sol serão salvos
+     * @param nomeArquivo Nome do arquivo de instância
+     * @param maxWaves Número máximo de waves (0 = sem limite)
+     * @return Número de waves geradas
+     */
+    int planejar(const std::string& diretorioSaida, const std::string& nomeArquivo, int maxWaves = 0);
+
+    int getNumPedidosRestantes() const { return numPedidosAtivos; }
+    const Deposito& getDeposito() const { return deposito; }
+
+private:
+    // Verifica limites e estoque da wave contra o depósito atual
+    bool waveViavel(const Solucao& wave) const;
+
+    // Desconta o estoque usado, retira os pedidos atendidos e reavalia os pedidos afetados
+    void consumirWave(const Solucao& wave);
+
+    Deposito deposito;
+    Backlog backlog;
+    LocalizadorItens localizador;
+    VerificadorDisponibilidade verificador;
+    AnalisadorRelevancia analisador;
+    AgrupadorPedidos agrupador;
+
+    // Formato CSR item -> pedidos que o solicitam (usado para limitar a reavaliação)
+    std::vector<int> inicioItemPedidos;
+    std::vector<int> pedidosDoItem;
+    std::vector<int> marcadorPedido;
+    int numPedidosAtivos;
+    int numWaves = 0;
+};
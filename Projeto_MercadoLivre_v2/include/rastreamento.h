@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * @brief Gravador opcional de linha do tempo no formato Chrome trace-event (chrome://tracing, Perfetto)
+ *
+ * Desligado, cada ponto de rastreamento custa uma leitura atômica relaxada. Ligado, cada thread
+ * grava num buffer circular próprio (produtor único, sem travas no caminho quente); o buffer é
+ * obtido de um pool na primeira gravação da thread e devolvido quando ela termina, de modo que o
+ * número de buffers acompanha o número de threads simultâneas e não o total de threads criadas.
+ * Quando um buffer enche, os eventos mais antigos são sobrescritos.
+ */
+class RastreadorEventos {
+public:
+    /**
+     * @brief Liga a gravação, descartando eventos anteriores
+     * @param eventosPorThread Capacidade de cada buffer circular
+     */
+    static void iniciar(size_t eventosPorThread = 1 << 16);
+
+    /**
+     * @brief Indica se a gravação está ligada
+     */
+    static bool ativo() { return ligado.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Desliga a gravação e escreve os eventos em JSON (chamar sem threads gravando)
+     * @param arquivo Caminho do arquivo .json
+     * @return true se o arquivo foi escrito
+     */
+    static bool finalizar(const std::string& arquivo);
+
+    /**
+     * @brief Nanossegundos desde iniciar()
+     */
+    static uint64_t agoraNs();
+
+    /**
+     * @brief Grava um intervalo completo ("ph": "X") da thread corrente
+     * @param nome Nome do evento (deve ter duração estática, ex.: literal)
+     * @param inicioNs Início, em agoraNs()
+     * @param detalhe Texto exibido nos argumentos (literal ou obtido com internar; opcional)
+     */
+    static void registrarIntervalo(const char* nome, uint64_t inicioNs, const char* detalhe = nullptr);
+
+    /**
+     * @brief Grava um evento instantâneo ("ph": "i") com um valor numérico
+     */
+    static void registrarInstante(const char* nome, double valor);
+
+    /**
+     * @brief Copia um texto para a tabela do rastreamento (válido até o próximo iniciar)
+     */
+    static const char* internar(const std::string& texto);
+
+private:
+    static std::atomic<bool> ligado;
+};
+
+/**
+ * @brief Intervalo de escopo: grava do construtor ao destrutor, se o rastreamento estiver ligado
+ */
+class IntervaloRastreado {
+public:
+    explicit IntervaloRastreado(const char* nome, const char* detalhe = nullptr)
+        : nome(RastreadorEventos::ativo() ? nome : nullptr), detalhe(detalhe),
+          inicioNs(this->nome ? RastreadorEventos::agoraNs() : 0) {}
+    ~IntervaloRastreado() {
+        if (nome) RastreadorEventos::registrarIntervalo(nome, inicioNs, detalhe);
+    }
+    IntervaloRastreado(const IntervaloRastreado&) = delete;
+    IntervaloRastreado& operator=(const IntervaloRastreado&) = delete;
+
+private:
+    const char* nome;
+    const char* detalhe;
+    uint64_t inicioNs;
+};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "armazem.h"
+#include "localizador_itens.h"
+#include "conjunto_pedidos.h"
+
+/**
+ * @brief Seleção de corredores para um conjunto fixo de pedidos
+ *
+ * Trata a escolha como um problema de cobertura múltipla: cada corredor custa 1 e cobre,
+ * de cada item, o mínimo entre seu estoque e a demanda ainda não atendida. Usa o guloso
+ * preguiçoso (fila de prioridade com coberturas reavaliadas apenas quando chegam ao topo)
+ * seguido de uma passada que elimina corredores redundantes.
+ *
+ * Trabalha sobre os CSR do LocalizadorItens e mantém buffers internos reutilizados entre
+ * chamadas; cada thread deve usar sua própria instância.
+ */
+class SeletorCorredores {
+public:
+    /**
+     * @brief Construtor
+     * @param localizador Estrutura auxiliar com os CSR item/corredor
+     */
+    explicit SeletorCorredores(const LocalizadorItens& localizador);
+    
+    /**
+     * @brief Seleciona corredores que atendem todos os pedidos informados
+     * @param backlog Dados do backlog
+     * @param pedidos IDs dos pedidos da wave
+     * @return IDs dos corredores escolhidos (vazio se não houver pedidos ou estoque suficiente)
+     */
+    std::vector<int> selecionar(const Backlog& backlog, const std::vector<int>& pedidos) {
+        std::vector<int> escolhidos;
+        selecionar(backlog, pedidos, escolhidos);
+        return escolhidos;
+    }
+    
+    /**
+     * @brief Sobrecarga para o conjunto indexado de pedidos de uma solução
+     */
+    std::vector<int> selecionar(const Backlog& backlog, const ConjuntoPedidos& pedidos) {
+        return selecionar(backlog, pedidos.ids());
+    }
+    
+    /**
+     * @brief Seleciona corredores gravando o resultado num vetor do chamador (sua capacidade é reaproveitada)
+     * @param backlog Dados do backlog
+     * @param pedidos IDs dos pedidos da wave
+     * @param escolhidos Recebe os IDs dos corredores escolhidos
+     */
+    void selecionar(const Backlog& backlog, const std::vector<int>& pedidos, std::vector<int>& escolhidos);
+    
+    /**
+     * @brief Bytes reservados pelos buffers reaproveitados entre chamadas
+     */
+    size_t bytesAlocados() const {
+        return (demandaRestante.capacity() + demandaTotal.capacity() + oferta.capacity() +
+                itensDemandados.capacity() + candidatos.capacity()) * sizeof(int) +
+               corredorVisto.capacity() * sizeof(uint64_t) + fila.capacity() * sizeof(fila[0]) +
+               mantido.capacity();
+    }
+    
+private:
+    // Unidades ainda não atendidas que o corredor cobriria
+    long long calcularCobertura(int corredorId) const;
+    
+    const LocalizadorItens& localizador;
+    std::vector<int> demandaRestante;      // itemId -> demanda ainda não coberta
+    std::vector<int> demandaTotal;         // itemId -> demanda total da wave
+    std::vector<int> oferta;               // itemId -> oferta dos corredores escolhidos
+    std::vector<uint64_t> corredorVisto;   // Mapa de bits dos corredores candidatos
+    std::vector<int> itensDemandados;
+    std::vector<int> candidatos;
+    std::vector<std::pair<long long, int>> fila; // Heap de (cobertura, -corredorId)
+    std::vector<char> mantido;
+};
@@ -20,16 +20,29 @@ struct SeletorWaves {
     };
     
     /**
-     * @brief Seleciona uma wave ótima usando os pedidos ordenados por relevância
+     * @brief Seleciona uma wave candidata entre janelas contíguas da lista ordenada por relevância
+     *
+     * Heurística de dois ponteiros: para cada início, o fim parte de onde parou no início
+     * anterior e avança enquanto as unidades couberem em UB; são avaliadas as janelas com
+     * unidades >= LB formadas nesse avanço (incluindo a janela máxima de cada início), não
+     * todas as janelas contíguas. O número de corredores de uma janela é uma estimativa: a
+     * união das coberturas gulosas de cada pedido isolado (LocalizadorItens::getCorredoresPedido),
+     * que pode exceder o mínimo necessário ou, quando pedidos disputam um item, ficar abaixo
+     * dele; quem usa a janela deve recalcular os corredores. Os inícios são divididos entre
+     * threads, e cada bloco parte do estado que a varredura sequencial teria no seu primeiro
+     * início, de modo que o resultado não depende do número de threads.
+     *
      * @param backlog Referência ao objeto Backlog
      * @param pedidosOrdenados Vetor de IDs de pedidos ordenados por relevância
      * @param analisador Referência ao objeto AnalisadorRelevancia
      * @param localizador Referência ao objeto LocalizadorItens
+     * @param numThreads Número de threads (0 = hardware_concurrency)
      * @return Uma WaveCandidata contendo a melhor seleção de pedidos
      */
     WaveCandidata selecionarWaveOtima(
         const Backlog& backlog,
         const std::vector<int>& pedidosOrdenados,
         const AnalisadorRelevancia& analisador,
-        const LocalizadorItens& localizador);
-};
\ No newline at end of file
+        const LocalizadorItens& localizador,
+        unsigned int numThreads = 0);
+};
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <istream>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include "cache_instancias.h"
+#include "solucionar_desafio.h"
+
+/**
+ * @brief Envia um quadro (4 bytes com o tamanho em big-endian seguidos do conteúdo)
+ * @param fd Descritor do socket
+ * @param conteudo Conteúdo do quadro
+ * @return true se o quadro foi enviado por completo
+ */
+bool enviarQuadro(int fd, const std::string& conteudo);
+
+/**
+ * @brief Recebe um quadro completo
+ * @param fd Descritor do socket
+ * @param conteudo Recebe o conteúdo do quadro
+ * @return false se a conexão foi encerrada ou o quadro é inválido
+ */
+bool receberQuadro(int fd, std::string& conteudo);
+
+/**
+ * @brief Servidor residente que atende requisições por um socket de domínio Unix
+ *
+ * Protocolo: cada mensagem é um quadro (ver enviarQuadro). A primeira linha da requisição
+ * é o comando; as linhas seguintes, quando houver, são o corpo.
+ *   SOLVE <instancia>                -> zero ou mais "INCUMBENT <valor>\n<.sol>", depois "RESULT <valor>\n<.sol>"
+ *   UPDATE <instancia>\n<alterações> -> "OK <numPedidos>" (formato de aplicarDelta)
+ *   VALIDATE <instancia>\n<.sol>     -> "VALIDO\n<relatório>" ou "INVALIDO\n<relatório>"
+ *   SHUTDOWN                         -> "OK" e encerra o servidor
+ * Falhas são respondidas com "ERRO <mensagem>". Uma conexão pode enviar várias requisições.
+ */
+class ServidorSolver {
+public:
+    /**
+     * @brief Construtor
+     * @param caminhoSocket Caminho do socket de domínio Unix
+     */
+    explicit ServidorSolver(std::string caminhoSocket);
+
+    /**
+     * @brief Escuta o socket e atende conexões (uma thread por conexão) até receber SHUTDOWN
+     */
+    void executar();
+
+private:
+    void atenderConexao(int fd);
+    void processarSolve(int fd, const std::string& caminho);
+    void processarUpdate(int fd, const std::string& caminho, std::istream& corpo);
+    void processarValidate(int fd, const std::string& caminho, std::istream& corpo);
+
+    std::string caminhoSocket;
+    CacheInstancias cache;
+    std::atomic<bool> ativo{true};
+    int fdServidor = -1;
+    std::mutex mutexConexoes;
+    std::unordered_set<int> fdsAbertos;
+};
@@ -1,28 +1,93 @@
 #pragma once
 
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 #include "armazem.h"
 #include "localizador_itens.h"
 #include "verificador_disponibilidade.h"
 #include "analisador_relevancia.h"
+#include "agrupador_pedidos.h"
+#include "conjunto_pedidos.h"
+#include "seletor_corredores.h"
 
-/**
- * @brief Resolve o desafio para todas as instâncias no diretório de entrada
- * @param diretorioEntrada Caminho para o diretório com os arquivos de instância
- * @param diretorioSaida Caminho para o diretório onde os resultados serão salvos
- */
-void solucionarDesafio(const std::string& diretorioEntrada, const std::string& diretorioSaida);
+class CacheInstancias;
 
 /**
  * @brief Estrutura para representar uma solução para uma instância
  */
 struct Solucao {
-    std::vector<int> pedidosWave;   // IDs dos pedidos na wave
+    ConjuntoPedidos pedidosWave;    // IDs dos pedidos na wave (pertinência em O(1))
     std::vector<int> corredoresWave; // IDs dos corredores usados na wave
     double valorObjetivo;          // Valor da função objetivo
 };
 
+/**
+ * @brief Função chamada a cada nova melhor solução encontrada durante a busca
+ */
+using CallbackIncumbente = std::function<void(const Solucao&)>;
+
+/**
+ * @brief Parâmetros de execução do solver
+ */
+struct ConfiguracaoSolver {
+    unsigned int numThreads = 0;        // Threads no total (0 = hardware_concurrency)
+    double tempoLimite = 0.0;           // Segundos por instância (0 = sem limite)
+    std::string algoritmo = "completo"; // "completo", "guloso" ou "janela"
+    uint64_t semente = 0;               // Semente do gerador aleatório (0 = não determinística)
+    int maxIteracoes = 100;             // Perturbações avaliadas pelo Dinkelbach
+    bool deterministico = false;        // Sorteios por tarefa derivados da semente; ignora tempoLimite
+    std::string afinidade = "nenhuma";  // "nenhuma", "no" (instâncias e suas threads por nó NUMA)
+                                        // ou "cpu" (como "no", com uma CPU por thread da busca)
+    int nosNuma = 0;                    // Nós usados pela afinidade (0 = todos os detectados)
+};
+
+/**
+ * @brief Resumo da resolução de uma instância
+ */
+struct ResumoInstancia {
+    std::string instancia;
+    double valorObjetivo = 0.0;
+    double limitanteSuperior = 0.0; // min(UB, maior estoque de um corredor)
+    double tempo = 0.0;             // Segundos, da leitura à escrita do .sol
+    int iteracoes = 0;              // Perturbações avaliadas
+    int numPedidos = 0;
+    int numCorredores = 0;
+    uint64_t memoriaPico = 0;       // Bytes, pico da conta de memória da instância
+    bool sucesso = false;
+};
+
+/**
+ * @brief Resolve o desafio para todas as instâncias no diretório de entrada
+ * @param diretorioEntrada Diretório com os arquivos de instância (.txt) ou um único arquivo
+ * @param diretorioSaida Caminho para o diretório onde os resultados serão salvos
+ * @param configuracao Threads, tempo por instância, algoritmo e semente
+ * @param cache Cache onde as instâncias lidas ficam disponíveis para a validação (opcional)
+ * @return Resumo de cada instância, na ordem dos arquivos
+ */
+std::vector<ResumoInstancia> solucionarDesafio(const std::string& diretorioEntrada, const std::string& diretorioSaida,
+                                               const ConfiguracaoSolver& configuracao = ConfiguracaoSolver{},
+                                               CacheInstancias* cache = nullptr);
+
+/**
+ * @brief Formata o resumo de uma instância numa linha "RESULTADO chave=valor ..."
+ */
+std::string formatarResumo(const ResumoInstancia& resumo);
+
+/**
+ * @brief Reinicia o gerador aleatório do solver com uma semente fixa
+ */
+void definirSemente(uint64_t semente);
+
+/**
+ * @brief Limitante superior simples do objetivo: nenhuma wave supera min(UB, maior estoque de um corredor)
+ * @param deposito Dados do depósito
+ * @param backlog Dados do backlog
+ * @return double Limitante superior para unidades / corredores
+ */
+double calcularLimitanteSuperior(const Deposito& deposito, const Backlog& backlog);
+
 /**
  * @brief Implementa o algoritmo guloso para gerar uma solução inicial
  * @param deposito Dados do depósito
@@ -37,6 +102,24 @@ Solucao gerarSolucaoInicial(const Deposito& deposito, const Backlog& backlog,
                            const VerificadorDisponibilidade& verificador,
                            const AnalisadorRelevancia& analisador);
 
+/**
+ * @brief Gera soluções iniciais semeadas pelos clusters de pedidos que compartilham corredores
+ * @param deposito Dados do depósito
+ * @param backlog Dados do backlog
+ * @param localizador Estrutura auxiliar para localização de itens nos corredores
+ * @param verificador Estrutura auxiliar para verificação de disponibilidade
+ * @param analisador Estrutura auxiliar para análise de relevância dos pedidos
+ * @param agrupador Clusters de pedidos obtidos por MinHash/LSH
+ * @param maxSementes Número máximo de clusters usados como semente
+ * @return std::vector<Solucao> Soluções que respeitam os limites LB e UB
+ */
+std::vector<Solucao> gerarSolucoesPorClusters(const Deposito& deposito, const Backlog& backlog,
+                                              const LocalizadorItens& localizador,
+                                              const VerificadorDisponibilidade& verificador,
+                                              const AnalisadorRelevancia& analisador,
+                                              const AgrupadorPedidos& agrupador,
+                                              int maxSementes = 16);
+
 /**
  * @brief Implementa o algoritmo de Dinkelbach modificado para perturbar a solução
  * @param deposito Dados do depósito
@@ -52,6 +135,29 @@ Solucao perturbarSolucao(const Deposito& deposito, const Backlog& backlog, const
                          const VerificadorDisponibilidade& verificador,
                          const AnalisadorRelevancia& analisador);
 
+/**
+ * @brief Buffers de uma thread da busca local, reaproveitados de uma perturbação para a outra
+ */
+struct AreaTrabalhoBusca {
+    explicit AreaTrabalhoBusca(const LocalizadorItens& localizador) : seletor(localizador) {}
+    SeletorCorredores seletor;
+};
+
+/**
+ * @brief Perturba a solução gravando o resultado em destino, sem alocar no regime permanente
+ *
+ * Os vetores de destino e os buffers da área de trabalho são reaproveitados; após as
+ * primeiras chamadas só há alocação quando a wave cresce além do maior tamanho já visto.
+ *
+ * @param solucaoAtual Solução atual a ser perturbada (não pode ser o próprio destino)
+ * @param area Área de trabalho da thread (o seletor de corredores já referencia o LocalizadorItens)
+ * @param destino Recebe a solução perturbada
+ */
+void perturbarSolucao(const Deposito& deposito, const Backlog& backlog, const Solucao& solucaoAtual,
+                      const VerificadorDisponibilidade& verificador,
+                      const AnalisadorRelevancia& analisador,
+                      AreaTrabalhoBusca& area, Solucao& destino);
+
 /**
  * @brief Implementa o algoritmo de Dinkelbach para otimização
  * @param deposito Dados do depósito
@@ -60,12 +166,18 @@ Solucao perturbarSolucao(const Deposito& deposito, const Backlog& backlog, const
  * @param localizador Estrutura auxiliar para localização de itens nos corredores
  * @param verificador Estrutura auxiliar para verificação de disponibilidade
  * @param analisador Estrutura auxiliar para análise de relevância dos pedidos
+ * @param configuracao Iterações, threads e tempo limite da busca
+ * @param aoMelhorar Chamada com cada solução aceita pela busca, ainda sem ajuste (opcional)
+ * @param iteracoesExecutadas Recebe o número de perturbações avaliadas (opcional)
  * @return Solucao Melhor solução encontrada pelo algoritmo de Dinkelbach
  */
 Solucao otimizarSolucao(const Deposito& deposito, const Backlog& backlog, const Solucao& solucaoInicial,
                        const LocalizadorItens& localizador,
                        const VerificadorDisponibilidade& verificador,
-                       const AnalisadorRelevancia& analisador);
+                       const AnalisadorRelevancia& analisador,
+                       const ConfiguracaoSolver& configuracao = ConfiguracaoSolver{},
+                       const CallbackIncumbente& aoMelhorar = nullptr,
+                       int* iteracoesExecutadas = nullptr);
 
 /**
  * @brief Calcula o valor da função objetivo para uma dada solução
@@ -76,13 +188,45 @@ Solucao otimizarSolucao(const Deposito& deposito, const Backlog& backlog, const
  */
 double calcularValorObjetivo(const Deposito& deposito, const Backlog& backlog, const Solucao& solucao);
 
+/**
+ * @brief Serializa uma solução no formato .sol
+ */
+std::string formatarSolucao(const Solucao& solucao);
+
 /**
  * @brief Salva a solução em um arquivo de saída
+ *
+ * O conteúdo é escrito de uma vez num arquivo temporário do mesmo diretório, que então
+ * é renomeado para o destino: leitores nunca veem um .sol pela metade.
+ *
  * @param diretorioSaida Caminho para o diretório de saída
  * @param nomeArquivo Nome do arquivo de saída
  * @param solucao Solução a ser salva
+ * @return true se o arquivo foi salvo
+ */
+bool salvarSolucao(const std::string& diretorioSaida, const std::string& nomeArquivo, const Solucao& solucao);
+
+/**
+ * @brief Resolve uma wave completa: sementes gulosa, por clusters e por janela, otimização e ajuste final
+ * @param deposito Dados do depósito
+ * @param backlog Dados do backlog
+ * @param localizador Estrutura auxiliar para localização de itens nos corredores
+ * @param verificador Estrutura auxiliar para verificação de disponibilidade
+ * @param analisador Estrutura auxiliar para análise de relevância dos pedidos
+ * @param agrupador Clusters de pedidos obtidos por MinHash/LSH
+ * @param aoMelhorar Chamada com a semente ajustada e a cada melhoria da melhor solução ajustada (opcional)
+ * @param configuracao Algoritmo, iterações, threads e tempo limite
+ * @param iteracoesExecutadas Recebe o número de perturbações avaliadas (opcional)
+ * @return Solucao Melhor wave encontrada
  */
-void salvarSolucao(const std::string& diretorioSaida, const std::string& nomeArquivo, const Solucao& solucao);
+Solucao resolverWave(const Deposito& deposito, const Backlog& backlog,
+                     const LocalizadorItens& localizador,
+                     const VerificadorDisponibilidade& verificador,
+                     const AnalisadorRelevancia& analisador,
+                     const AgrupadorPedidos& agrupador,
+                     const CallbackIncumbente& aoMelhorar = nullptr,
+                     const ConfiguracaoSolver& configuracao = ConfiguracaoSolver{},
+                     int* iteracoesExecutadas = nullptr);
 
 /**
  * @brief Ajusta a solução removendo pedidos com estoque insuficiente e garantindo que o limite inferior seja atendido
@@ -91,8 +235,12 @@ void salvarSolucao(const std::string& diretorioSaida, const std::string& nomeArq
  * @param solucao Solução a ser ajustada
  * @param localizador Estrutura auxiliar para localização de itens nos corredores
  * @param verificador Estrutura auxiliar para verificação de disponibilidade
+ * @param analisador Estrutura auxiliar para análise de relevância dos pedidos
+ * @param numThreads Threads disponíveis para a verificação em lote (1 = na thread chamadora)
  * @return Solucao Solução ajustada
  */
 Solucao ajustarSolucao(const Deposito& deposito, const Backlog& backlog, Solucao solucao,
                       const LocalizadorItens& localizador,
-                      const VerificadorDisponibilidade& verificador);
\ No newline at end of file
+                      const VerificadorDisponibilidade& verificador,
+                      const AnalisadorRelevancia& analisador,
+                      unsigned int numThreads = 1);
\ No newline at end of file
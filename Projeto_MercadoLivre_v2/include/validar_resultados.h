@@ -1,9 +1,99 @@
 #pragma once
 
+#include <istream>
+#include <ostream>
 #include <string>
+#include <vector>
+#include "armazem.h"
+#include "instancia.h"
+#include "cache_instancias.h"
+
+/**
+ * @brief Estrutura para armazenar os dados de um arquivo de solução
+ */
+struct SolucaoValidacao {
+    std::vector<int> pedidosWave;
+    std::vector<int> corredoresWave;
+};
+
+/**
+ * @brief Lê um arquivo de solução e retorna os dados
+ * @param arquivoSolucao Caminho para o arquivo de solução
+ * @return SolucaoValidacao Estrutura com os dados do arquivo de solução
+ */
+SolucaoValidacao lerArquivoSolucao(const std::string& arquivoSolucao);
+
+/**
+ * @brief Lê uma solução no formato .sol a partir de um fluxo
+ * @param file Fluxo de entrada posicionado no início da solução
+ * @return SolucaoValidacao Estrutura com os dados da solução
+ */
+SolucaoValidacao lerSolucao(std::istream& file);
+
+/**
+ * @brief Resultado estruturado da validação de uma solução
+ */
+struct RelatorioValidacao {
+    std::string instancia;          // Nome da instância (sem extensão)
+    std::string arquivoSolucao;
+    bool valida = false;
+    bool idsPedidosValidos = false;
+    bool idsCorredoresValidos = false;
+    bool semRepeticoes = false;     // Nenhum pedido ou corredor listado duas vezes
+    bool unidadesNosLimites = false;
+    bool estoqueSuficiente = false;
+    int numPedidos = 0;
+    int numCorredores = 0;
+    int totalUnidades = 0;
+    int LB = 0;
+    int UB = 0;
+    double valorObjetivo = 0.0;     // Unidades / corredores
+    int idInvalido = -1;            // Primeiro ID fora do intervalo
+    int itemSemEstoque = -1;        // Primeiro item cuja demanda excede o estoque dos corredores
+    int demandaItem = 0;
+    int estoqueItem = 0;
+    std::string erro;               // Falha ao ler a instância ou a solução
+    double tempoMs = 0.0;
+};
+
+/**
+ * @brief Valida uma solução usando as estruturas da instância (CSR do backlog e mapas de bits)
+ *
+ * A demanda somada de todos os pedidos da wave é comparada, item a item, com o estoque
+ * dos corredores visitados.
+ *
+ * @param instancia Instância compartilhada
+ * @param solucao Solução lida do arquivo
+ * @return RelatorioValidacao Resultado de cada verificação e o valor objetivo
+ */
+RelatorioValidacao validarSolucao(const Instancia& instancia, const SolucaoValidacao& solucao);
+
+/**
+ * @brief Valida em paralelo as soluções de todas as instâncias de um diretório
+ * @param diretorioEntrada Diretório com os arquivos de instância (.txt)
+ * @param diretorioSaida Diretório com os arquivos de solução (.sol)
+ * @param cache Cache de instâncias (reaproveita as já lidas pelo solver)
+ * @param numThreads Número de threads (0 = hardware_concurrency)
+ * @return Um relatório por instância, na ordem dos arquivos
+ */
+std::vector<RelatorioValidacao> validarLote(const std::string& diretorioEntrada, const std::string& diretorioSaida,
+                                            CacheInstancias& cache, unsigned int numThreads = 0);
+
+/**
+ * @brief Escreve o relatório de uma solução no formato texto do log de validação
+ */
+void escreverRelatorioTexto(const RelatorioValidacao& relatorio, std::ostream& saida);
+
+/**
+ * @brief Escreve os relatórios em JSON ({"instancias": [...], "total", "aprovadas", "somaObjetivos"})
+ */
+void escreverRelatorioJson(const std::vector<RelatorioValidacao>& relatorios, std::ostream& saida);
 
 /**
  * @brief Valida os arquivos de solução comparando-os com os arquivos de entrada
+ *
+ * Grava o relatório texto em arquivoLog e o relatório JSON ao lado, com a extensão .json.
+ *
  * @param diretorioEntrada Caminho para o diretório com os arquivos de instância
  * @param diretorioSaida Caminho para o diretório com os arquivos de solução
  * @param arquivoLog Caminho para o arquivo de log de validação
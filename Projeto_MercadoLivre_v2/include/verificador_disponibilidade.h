@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <vector>
 #include <map>
 #include "armazem.h"
@@ -11,6 +12,19 @@ struct VerificadorDisponibilidade {
     // itemId -> quantidade total disponível em todos os corredores
     std::vector<int> estoqueTotal;
     
+    // Formato CSR do backlog: itens do pedido p nas posições [inicioPedido[p], inicioPedido[p + 1]).
+    // pedidoDaEntrada guarda o pedido dono de cada posição.
+    std::vector<int> inicioPedido;
+    std::vector<int> itemPedido;
+    std::vector<int> quantidadePedido;
+    std::vector<int> pedidoDaEntrada;
+    
+    // Mapa de bits dos pedidos atendíveis com o estoque total (preenchido por indexarPedidos)
+    std::vector<uint64_t> pedidosAtendiveis;
+    
+    // Mapa de bits dos pedidos ainda presentes no backlog (pedidos removidos nunca são atendíveis)
+    std::vector<uint64_t> pedidosAtivos;
+    
     /**
      * @brief Construtor
      * @param numItens Número total de itens no depósito
@@ -23,10 +37,75 @@ struct VerificadorDisponibilidade {
      */
     void construir(const Deposito& deposito);
     
+    /**
+     * @brief Monta o CSR do backlog e o mapa de pedidos atendíveis com o estoque total
+     * @param backlog Referência ao objeto Backlog
+     * @param numThreads Número de threads para a verificação inicial (0 = hardware_concurrency)
+     */
+    void indexarPedidos(const Backlog& backlog, unsigned int numThreads = 0);
+    
     /**
      * @brief Verifica se há estoque suficiente para um pedido
      * @param pedido Mapa de itens e quantidades solicitadas
      * @return true se há estoque suficiente, false caso contrário
      */
     bool verificarDisponibilidade(const std::map<int, int>& pedido) const;
-};
\ No newline at end of file
+    
+    /**
+     * @brief Consulta em O(1) se um pedido é atendível com o estoque total (requer indexarPedidos)
+     * @param pedidoId ID do pedido
+     */
+    bool pedidoAtendivel(int pedidoId) const {
+        return (pedidosAtendiveis[pedidoId >> 6] >> (pedidoId & 63)) & 1ULL;
+    }
+    
+    /**
+     * @brief Acrescenta um pedido novo ao final do CSR e dos mapas de bits (custo O(itens do pedido))
+     * @param pedido Mapa de itens e quantidades solicitadas
+     * @return ID atribuído ao pedido (igual ao número anterior de pedidos)
+     */
+    int adicionarPedido(const std::map<int, int>& pedido);
+    
+    /**
+     * @brief Retira um pedido do backlog (por exemplo, após ser atendido por uma wave)
+     * @param pedidoId ID do pedido
+     */
+    void removerPedido(int pedidoId);
+    
+    /**
+     * @brief Desconta unidades do estoque total de um item
+     * @param itemId ID do item
+     * @param quantidade Unidades consumidas
+     */
+    void consumirEstoque(int itemId, int quantidade) { estoqueTotal[itemId] -= quantidade; }
+    
+    /**
+     * @brief Reavalia a atendibilidade de um subconjunto de pedidos após alterações no estoque
+     * @param pedidos IDs dos pedidos afetados (pedidos removidos são ignorados)
+     */
+    void reverificarPedidos(const std::vector<int>& pedidos);
+    
+    /**
+     * @brief Verifica, em lote, quais pedidos ativos do backlog cabem individualmente num estoque
+     * @param estoque Estoque por item (total ou restrito a um conjunto de corredores)
+     * @param numThreads Número de threads (0 = hardware_concurrency)
+     * @return Mapa de bits indexado pelo ID do pedido (bit 1 = atendível)
+     */
+    std::vector<uint64_t> verificarLote(const std::vector<int>& estoque, unsigned int numThreads = 0) const;
+    
+    /**
+     * @brief Verifica, em lote, um subconjunto de pedidos contra um estoque
+     * @param pedidos IDs dos pedidos a verificar
+     * @param estoque Estoque por item
+     * @return Mapa de bits indexado pelo ID do pedido (apenas pedidos do subconjunto podem ter bit 1)
+     */
+    std::vector<uint64_t> verificarLote(const std::vector<int>& pedidos, const std::vector<int>& estoque) const;
+    
+    /**
+     * @brief Calcula o estoque por item restrito a um conjunto de corredores
+     * @param deposito Referência ao objeto Deposito
+     * @param corredores IDs dos corredores abertos
+     * @return Vetor itemId -> quantidade disponível nesses corredores
+     */
+    std::vector<int> calcularEstoque(const Deposito& deposito, const std::vector<int>& corredores) const;
+};
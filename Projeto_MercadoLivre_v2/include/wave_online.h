@@ -0,0 +1,103 @@
+#pragma once
+
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "armazem.h"
+#include "instancia.h"
+#include "localizador_itens.h"
+#include "verificador_disponibilidade.h"
+#include "analisador_relevancia.h"
+#include "solucionar_desafio.h"
+
+/**
+ * @brief Manutenção online de uma wave enquanto pedidos chegam e são cancelados
+ *
+ * Cada evento custa O(itens do pedido) mais, no máximo, a abertura de alguns corredores:
+ * o pedido é acrescentado ao backlog, ao VerificadorDisponibilidade e ao AnalisadorRelevancia,
+ * e entra na wave corrente se couber na oferta dos corredores já abertos (ou, enquanto a wave
+ * estiver abaixo do LB, abrindo os corredores que faltam). Uma thread em segundo plano
+ * reotimiza a wave a partir de uma cópia do backlog e publica o resultado se ele ainda for
+ * melhor depois de descontados os cancelamentos ocorridos durante a reotimização.
+ * O depósito é fixo; alterações de estoque não são eventos deste modo.
+ */
+class WaveOnline {
+public:
+    /**
+     * @brief Construtor: resolve a wave inicial e inicia a reotimização em segundo plano
+     * @param instancia Instância com o depósito e o backlog iniciais
+     */
+    explicit WaveOnline(const InstanciaPtr& instancia);
+    ~WaveOnline();
+
+    WaveOnline(const WaveOnline&) = delete;
+    WaveOnline& operator=(const WaveOnline&) = delete;
+
+    /**
+     * @brief Inclui um pedido novo
+     * @param pedido Mapa de itens e quantidades solicitadas
+     * @return ID atribuído ao pedido
+     */
+    int incluirPedido(std::map<int, int> pedido);
+
+    /**
+     * @brief Cancela um pedido (o ID é mantido, com o pedido vazio)
+     * @param pedidoId ID do pedido
+     * @return false se o ID não existe ou o pedido já estava cancelado
+     */
+    bool cancelarPedido(int pedidoId);
+
+    /**
+     * @brief Aplica um evento no formato do arquivo de alterações ("+ k item qtd ..." ou "- pedidoId")
+     * @param linha Linha do evento (linhas vazias e comentários são ignorados)
+     * @return false se a linha não continha evento
+     */
+    bool processarEvento(const std::string& linha);
+
+    /**
+     * @brief Obtém uma cópia da wave corrente
+     */
+    Solucao getWave() const;
+
+    /**
+     * @brief Indica se a wave corrente respeita o LB (o UB e o estoque são sempre mantidos)
+     */
+    bool waveValida() const;
+
+    /**
+     * @brief Bloqueia até que a reotimização em segundo plano alcance o último evento
+     */
+    void aguardarOtimizacao();
+
+private:
+    bool tentarIncluirNaWave(int pedidoId, bool permitirNovosCorredores);
+    void retirarDaWave(int pedidoId);
+    void abrirCorredor(int corredorId);
+    void publicar(const Solucao& nova, int numPedidosNaCopia);
+    void atualizarObjetivo();
+    void executarReotimizacao();
+
+    InstanciaPtr base;
+    const Deposito& deposito;
+    const LocalizadorItens& localizador;
+    Backlog backlog;
+    VerificadorDisponibilidade verificador;
+    AnalisadorRelevancia analisador;
+
+    // Wave corrente com demanda e oferta por item (oferta = estoque dos corredores abertos)
+    Solucao wave;
+    std::vector<int> demanda;
+    std::vector<int> oferta;
+    std::vector<char> corredorAberto;
+    int unidades = 0;
+
+    mutable std::mutex mutex;
+    std::condition_variable condicao;
+    bool pendente = false;   // há eventos ainda não vistos pela reotimização
+    bool ocupado = false;    // reotimização em andamento
+    bool parar = false;
+    std::thread otimizador;
+};
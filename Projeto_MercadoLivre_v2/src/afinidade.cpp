@@ -0,0 +1,100 @@
+#include "afinidade.h"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+
+// Interpreta listas no formato do kernel, ex.: "0-3,8-11"
+std::vector<int> lerListaCpus(const std::string& texto) {
+    std::vector<int> cpus;
+    std::stringstream ss(texto);
+    std::string faixa;
+    while (std::getline(ss, faixa, ',')) {
+        if (faixa.empty() || faixa == "\n") continue;
+        size_t traco = faixa.find('-');
+        try {
+            int inicio = std::stoi(faixa.substr(0, traco));
+            int fim = traco == std::string::npos ? inicio : std::stoi(faixa.substr(traco + 1));
+            for (int cpu = inicio; cpu <= fim; cpu++) {
+                cpus.push_back(cpu);
+            }
+        } catch (const std::exception&) {
+            return {};
+        }
+    }
+    return cpus;
+}
+
+} // namespace
+
+std::vector<int> cpusDaThread() {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t mascara;
+    CPU_ZERO(&mascara);
+    if (pthread_getaffinity_np(pthread_self(), sizeof(mascara), &mascara) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &mascara)) cpus.push_back(cpu);
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        unsigned int numCpus = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned int cpu = 0; cpu < numCpus; cpu++) {
+            cpus.push_back(static_cast<int>(cpu));
+        }
+    }
+    return cpus;
+}
+
+bool fixarThreadEmCpus(const std::vector<int>& cpus) {
+#ifdef __linux__
+    if (cpus.empty()) return false;
+    cpu_set_t mascara;
+    CPU_ZERO(&mascara);
+    for (int cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) CPU_SET(cpu, &mascara);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(mascara), &mascara) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+TopologiaNuma TopologiaNuma::detectar(int maxNos) {
+    std::vector<int> permitidas = cpusDaThread();
+    std::sort(permitidas.begin(), permitidas.end());
+
+    TopologiaNuma topologia;
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string linha;
+    if (online && std::getline(online, linha)) {
+        for (int no : lerListaCpus(linha)) {
+            std::ifstream arquivo("/sys/devices/system/node/node" + std::to_string(no) + "/cpulist");
+            std::string lista;
+            if (!arquivo || !std::getline(arquivo, lista)) continue;
+
+            std::vector<int> cpus;
+            for (int cpu : lerListaCpus(lista)) {
+                if (std::binary_search(permitidas.begin(), permitidas.end(), cpu)) cpus.push_back(cpu);
+            }
+            if (!cpus.empty()) topologia.cpusPorNo.push_back(std::move(cpus));
+        }
+    }
+    if (topologia.cpusPorNo.empty()) {
+        topologia.cpusPorNo.push_back(permitidas);
+    }
+    if (maxNos > 0 && static_cast<int>(topologia.cpusPorNo.size()) > maxNos) {
+        topologia.cpusPorNo.resize(maxNos);
+    }
+    return topologia;
+}
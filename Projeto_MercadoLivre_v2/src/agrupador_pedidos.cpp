@@ -0,0 +1,113 @@
+#include "agrupador_pedidos.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+
+namespace {
+
+// Função de mistura (splitmix64) usada para derivar as funções de hash do MinHash
+uint64_t misturar(uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+int encontrarRaiz(std::vector<int>& pai, int x) {
+    while (pai[x] != x) {
+        pai[x] = pai[pai[x]];
+        x = pai[x];
+    }
+    return x;
+}
+
+} // namespace
+
+void AgrupadorPedidos::construir(const Backlog& backlog, const LocalizadorItens& localizador,
+                                 double similaridadeMinima) {
+    const int numPedidos = backlog.numPedidos;
+    std::vector<char> possuiCorredores(numPedidos, 0);
+    
+    // 1. Assinaturas MinHash do conjunto de corredores de cada pedido
+    for (int pedidoId = 0; pedidoId < numPedidos; pedidoId++) {
+        uint32_t* assinatura = &assinaturas[static_cast<size_t>(pedidoId) * NUM_HASHES];
+        std::fill(assinatura, assinatura + NUM_HASHES, std::numeric_limits<uint32_t>::max());
+        
+        std::vector<int> corredores = localizador.getCorredoresPedido(backlog.pedido[pedidoId]);
+        possuiCorredores[pedidoId] = !corredores.empty();
+        
+        for (int corredorId : corredores) {
+            uint64_t base = misturar(static_cast<uint64_t>(corredorId));
+            for (int h = 0; h < NUM_HASHES; h++) {
+                uint32_t valor = static_cast<uint32_t>(misturar(base + h) >> 32);
+                assinatura[h] = std::min(assinatura[h], valor);
+            }
+        }
+    }
+    
+    // 2. LSH por bandas: pedidos com uma banda idêntica caem no mesmo balde
+    std::vector<int> pai(numPedidos);
+    std::iota(pai.begin(), pai.end(), 0);
+    
+    std::unordered_map<uint64_t, int> baldes;
+    baldes.reserve(numPedidos);
+    
+    for (int banda = 0; banda < NUM_BANDAS; banda++) {
+        baldes.clear();
+        for (int pedidoId = 0; pedidoId < numPedidos; pedidoId++) {
+            if (!possuiCorredores[pedidoId]) continue;
+            
+            const uint32_t* linhas = &assinaturas[static_cast<size_t>(pedidoId) * NUM_HASHES + 
+                                                  banda * LINHAS_POR_BANDA];
+            uint64_t chave = misturar(banda);
+            for (int r = 0; r < LINHAS_POR_BANDA; r++) {
+                chave = misturar(chave ^ linhas[r]);
+            }
+            
+            auto [it, inserido] = baldes.emplace(chave, pedidoId);
+            if (inserido) continue;
+            
+            // Confirmar a similaridade com o representante do balde para evitar
+            // que colisões encadeadas formem clusters gigantes
+            if (similaridadeEstimada(pedidoId, it->second) >= similaridadeMinima) {
+                int raizA = encontrarRaiz(pai, pedidoId);
+                int raizB = encontrarRaiz(pai, it->second);
+                if (raizA != raizB) pai[raizA] = raizB;
+            }
+        }
+    }
+    
+    // 3. Montar os clusters a partir das componentes
+    std::unordered_map<int, int> indicePorRaiz;
+    clusters.clear();
+    for (int pedidoId = 0; pedidoId < numPedidos; pedidoId++) {
+        if (!possuiCorredores[pedidoId]) continue;
+        
+        int raiz = encontrarRaiz(pai, pedidoId);
+        auto [it, inserido] = indicePorRaiz.emplace(raiz, static_cast<int>(clusters.size()));
+        if (inserido) clusters.emplace_back();
+        clusters[it->second].push_back(pedidoId);
+    }
+    
+    std::stable_sort(clusters.begin(), clusters.end(),
+        [](const auto& a, const auto& b) { return a.size() > b.size(); });
+    
+    std::fill(clusterDoPedido.begin(), clusterDoPedido.end(), -1);
+    for (int c = 0; c < static_cast<int>(clusters.size()); c++) {
+        for (int pedidoId : clusters[c]) {
+            clusterDoPedido[pedidoId] = c;
+        }
+    }
+}
+
+double AgrupadorPedidos::similaridadeEstimada(int pedidoA, int pedidoB) const {
+    const uint32_t* a = &assinaturas[static_cast<size_t>(pedidoA) * NUM_HASHES];
+    const uint32_t* b = &assinaturas[static_cast<size_t>(pedidoB) * NUM_HASHES];
+    
+    int iguais = 0;
+    for (int h = 0; h < NUM_HASHES; h++) {
+        iguais += (a[h] == b[h]);
+    }
+    return static_cast<double>(iguais) / NUM_HASHES;
+}
@@ -1,4 +1,153 @@
 #include "analisador_relevancia.h"
+#include <algorithm>
+#include <thread>
 
-// As implementações foram movidas para o header (analisador_relevancia.h)
-// para suportar a versão paralelizada da classe.
\ No newline at end of file
+namespace {
+
+// Número mínimo de pedidos por bloco para compensar a criação de uma thread
+constexpr int PEDIDOS_POR_BLOCO = 2048;
+
+} // namespace
+
+void AnalisadorRelevancia::construir(const Backlog& backlog, const LocalizadorItens& localizador,
+                                     unsigned int numThreads) {
+    const int numPedidos = backlog.numPedidos;
+    
+    // Avalia os pedidos [inicio, fim); cada bloco usa seu próprio marcador de corredores
+    auto avaliarBloco = [&](int inicio, int fim) {
+        std::vector<int> marcador(localizador.numCorredores, -1);
+        
+        for (int pedidoId = inicio; pedidoId < fim; pedidoId++) {
+            // Pedidos vazios (por exemplo, cancelados) não entram no ranking
+            ativo[pedidoId] = !backlog.pedido[pedidoId].empty();
+            avaliarPedido(backlog, localizador, pedidoId, marcador);
+        }
+    };
+    
+    if (numThreads == 0) numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 4;
+    numThreads = std::max(1u, std::min(numThreads,
+        static_cast<unsigned int>((numPedidos + PEDIDOS_POR_BLOCO - 1) / PEDIDOS_POR_BLOCO)));
+    
+    if (numThreads == 1) {
+        avaliarBloco(0, numPedidos);
+    } else {
+        std::vector<std::thread> threads;
+        int tamanhoBloco = (numPedidos + numThreads - 1) / numThreads;
+        for (unsigned int t = 0; t < numThreads; t++) {
+            int inicio = std::min(numPedidos, static_cast<int>(t) * tamanhoBloco);
+            int fim = std::min(numPedidos, inicio + tamanhoBloco);
+            threads.emplace_back(avaliarBloco, inicio, fim);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    
+    invalidarRanking();
+}
+
+void AnalisadorRelevancia::avaliarPedido(const Backlog& backlog, const LocalizadorItens& localizador,
+                                         int pedidoId, std::vector<int>& marcador) {
+    const auto& pedido = backlog.pedido[pedidoId];
+    int unidades = 0;
+    int corredores = 0;
+    
+    for (const auto& [itemId, quantidadeSolicitada] : pedido) {
+        unidades += quantidadeSolicitada;
+        
+        // Corredores com mais estoque primeiro (CSR já ordenado)
+        int quantidadeRestante = quantidadeSolicitada;
+        for (int k = localizador.inicioItem[itemId]; 
+             k < localizador.inicioItem[itemId + 1] && quantidadeRestante > 0 &&
+             localizador.quantidadeOrdenada[k] > 0; k++) {
+            int corredorId = localizador.corredorOrdenado[k];
+            if (marcador[corredorId] != pedidoId) {
+                marcador[corredorId] = pedidoId;
+                corredores++;
+            }
+            quantidadeRestante -= std::min(quantidadeRestante, localizador.quantidadeOrdenada[k]);
+        }
+    }
+    
+    numItens[pedidoId] = static_cast<int>(pedido.size());
+    numUnidades[pedidoId] = unidades;
+    numCorredoresMinimo[pedidoId] = corredores;
+    
+    // Calcular pontuação de relevância (mais itens, menos corredores = melhor)
+    pontuacaoRelevancia[pedidoId] = (numItens[pedidoId] * unidades) / 
+                                    static_cast<double>(std::max(1, corredores));
+}
+
+void AnalisadorRelevancia::reavaliarPedidos(const Backlog& backlog, const LocalizadorItens& localizador,
+                                            const std::vector<int>& pedidos) {
+    std::vector<int> marcador(localizador.numCorredores, -1);
+    for (int pedidoId : pedidos) {
+        if (ativo[pedidoId]) {
+            avaliarPedido(backlog, localizador, pedidoId, marcador);
+        }
+    }
+    invalidarRanking();
+}
+
+int AnalisadorRelevancia::adicionarPedido(const Backlog& backlog, const LocalizadorItens& localizador) {
+    const int pedidoId = static_cast<int>(numItens.size());
+    numItens.push_back(0);
+    numUnidades.push_back(0);
+    numCorredoresMinimo.push_back(0);
+    pontuacaoRelevancia.push_back(0.0);
+    ativo.push_back(!backlog.pedido[pedidoId].empty());
+    
+    std::vector<int> marcador(localizador.numCorredores, -1);
+    avaliarPedido(backlog, localizador, pedidoId, marcador);
+    invalidarRanking();
+    return pedidoId;
+}
+
+void AnalisadorRelevancia::removerPedido(int pedidoId) {
+    ativo[pedidoId] = 0;
+    invalidarRanking();
+}
+
+AnalisadorRelevancia::InfoPedido AnalisadorRelevancia::getInfoPedido(int pedidoId) const {
+    return {pedidoId, numItens[pedidoId], numUnidades[pedidoId],
+            numCorredoresMinimo[pedidoId], pontuacaoRelevancia[pedidoId]};
+}
+
+const std::vector<int>& AnalisadorRelevancia::getPedidosOrdenadosPorRelevancia() const {
+    if (!rankingValido.load(std::memory_order_acquire)) {
+        std::lock_guard<std::mutex> lock(mutexRanking);
+        if (!rankingValido.load(std::memory_order_relaxed)) {
+            ranking.clear();
+            for (int pedidoId = 0; pedidoId < static_cast<int>(ativo.size()); pedidoId++) {
+                if (ativo[pedidoId]) ranking.push_back(pedidoId);
+            }
+            std::sort(ranking.begin(), ranking.end(),
+                [this](int a, int b) { return maisRelevante(a, b); });
+            rankingValido.store(true, std::memory_order_release);
+        }
+    }
+    return ranking;
+}
+
+std::vector<int> AnalisadorRelevancia::getPedidosMaisRelevantes(size_t k) const {
+    if (rankingValido.load(std::memory_order_acquire)) {
+        k = std::min(k, ranking.size());
+        return std::vector<int>(ranking.begin(), ranking.begin() + k);
+    }
+    
+    std::vector<int> pedidos;
+    for (int pedidoId = 0; pedidoId < static_cast<int>(ativo.size()); pedidoId++) {
+        if (ativo[pedidoId]) pedidos.push_back(pedidoId);
+    }
+    k = std::min(k, pedidos.size());
+    std::partial_sort(pedidos.begin(), pedidos.begin() + k, pedidos.end(),
+        [this](int a, int b) { return maisRelevante(a, b); });
+    pedidos.resize(k);
+    return pedidos;
+}
+
+void AnalisadorRelevancia::invalidarRanking() {
+    std::lock_guard<std::mutex> lock(mutexRanking);
+    rankingValido.store(false, std::memory_order_release);
+}
@@ -0,0 +1,228 @@
+#include "avaliacao_qualidade.h"
+#include "instancia.h"
+#include "validar_resultados.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <sys/resource.h>
+
+namespace {
+
+// Zera o pico de memória residente do processo (Linux >= 4.0); sem suporte, o pico é cumulativo
+void reiniciarPicoMemoria() {
+    std::ofstream clearRefs("/proc/self/clear_refs");
+    if (clearRefs.is_open()) {
+        clearRefs << "5";
+    }
+}
+
+long lerPicoMemoriaKB() {
+    std::ifstream status("/proc/self/status");
+    std::string linha;
+    while (std::getline(status, linha)) {
+        if (linha.rfind("VmHWM:", 0) == 0) {
+            return std::stol(linha.substr(6));
+        }
+    }
+    rusage uso{};
+    getrusage(RUSAGE_SELF, &uso);
+    return uso.ru_maxrss;
+}
+
+std::string nomeColunaTempo(double tempo) {
+    std::ostringstream nome;
+    nome << "objetivo_" << tempo << "s";
+    return nome.str();
+}
+
+std::vector<std::string> dividirCsv(const std::string& linha) {
+    std::vector<std::string> campos;
+    std::stringstream ss(linha);
+    std::string campo;
+    while (std::getline(ss, campo, ',')) {
+        campos.push_back(campo);
+    }
+    return campos;
+}
+
+} // namespace
+
+ResultadoQualidade avaliarInstancia(const std::string& arquivoInstancia, const ConfiguracaoSolver& configuracao,
+                                    const std::vector<double>& temposCorte) {
+    ResultadoQualidade resultado;
+    resultado.instancia = std::filesystem::path(arquivoInstancia).stem().string();
+    resultado.numThreads = configuracao.numThreads;
+    if (configuracao.semente != 0) {
+        definirSemente(configuracao.semente);
+    }
+
+    reiniciarPicoMemoria();
+    auto inicio = std::chrono::steady_clock::now();
+    auto decorrido = [&inicio]() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    };
+
+    try {
+        InstanciaPtr instancia = Instancia::carregar(arquivoInstancia);
+        const Deposito& deposito = instancia->getDeposito();
+        const Backlog& backlog = instancia->getBacklog();
+        const LocalizadorItens& localizador = instancia->getLocalizador();
+        const VerificadorDisponibilidade& verificador = instancia->getVerificador();
+        const AnalisadorRelevancia& analisador = instancia->getAnalisador();
+
+        // O solver repassa a melhor solução já ajustada a cada melhoria
+        auto aoMelhorar = [&](const Solucao& incumbente) {
+            resultado.curva.push_back({decorrido(), incumbente.valorObjetivo});
+        };
+        Solucao solucao = resolverWave(deposito, backlog, localizador, verificador, analisador,
+                                       instancia->getAgrupador(), aoMelhorar, configuracao);
+        resultado.tempoTotal = decorrido();
+        if (resultado.curva.empty() || solucao.valorObjetivo > resultado.curva.back().objetivo) {
+            resultado.curva.push_back({resultado.tempoTotal, solucao.valorObjetivo});
+        }
+
+        resultado.objetivoFinal = solucao.valorObjetivo;
+        resultado.limitanteSuperior = calcularLimitanteSuperior(deposito, backlog);
+        if (resultado.limitanteSuperior > 0.0) {
+            resultado.gap = (resultado.limitanteSuperior - resultado.objetivoFinal) / resultado.limitanteSuperior;
+        }
+        SolucaoValidacao arquivo{solucao.pedidosWave.ids(), solucao.corredoresWave};
+        resultado.valida = validarSolucao(*instancia, arquivo).valida;
+    } catch (const std::exception& e) {
+        resultado.erro = e.what();
+        resultado.tempoTotal = decorrido();
+    }
+    resultado.memoriaPicoKB = lerPicoMemoriaKB();
+
+    // Melhor objetivo conhecido em cada tempo de corte
+    for (double corte : temposCorte) {
+        double melhor = 0.0;
+        for (const PontoCurva& ponto : resultado.curva) {
+            if (ponto.tempo <= corte) melhor = std::max(melhor, ponto.objetivo);
+        }
+        resultado.objetivoNosTempos.push_back(melhor);
+    }
+    return resultado;
+}
+
+void escreverQualidadeCsv(const std::vector<ResultadoQualidade>& resultados, const std::vector<double>& temposCorte,
+                          std::ostream& saida) {
+    saida << "instancia,threads,objetivo_final,limitante,gap,tempo_total_s,memoria_pico_kb,valida";
+    for (double corte : temposCorte) {
+        saida << "," << nomeColunaTempo(corte);
+    }
+    saida << "\n";
+    for (const ResultadoQualidade& r : resultados) {
+        saida << r.instancia << "," << r.numThreads << "," << r.objetivoFinal << "," << r.limitanteSuperior << ","
+              << r.gap << "," << r.tempoTotal << "," << r.memoriaPicoKB << "," << (r.valida ? 1 : 0);
+        for (double objetivo : r.objetivoNosTempos) {
+            saida << "," << objetivo;
+        }
+        saida << "\n";
+    }
+}
+
+void escreverQualidadeJson(const std::vector<ResultadoQualidade>& resultados, const std::vector<double>& temposCorte,
+                           std::ostream& saida) {
+    saida << "{\n  \"temposCorte\": [";
+    for (size_t i = 0; i < temposCorte.size(); i++) {
+        saida << (i ? ", " : "") << temposCorte[i];
+    }
+    saida << "],\n  \"instancias\": [";
+    for (size_t i = 0; i < resultados.size(); i++) {
+        const ResultadoQualidade& r = resultados[i];
+        saida << (i ? ",\n    {" : "\n    {")
+              << "\"instancia\": \"" << r.instancia << "\", \"threads\": " << r.numThreads
+              << ", \"objetivoFinal\": " << r.objetivoFinal << ", \"limitante\": " << r.limitanteSuperior
+              << ", \"gap\": " << r.gap << ", \"tempoTotal\": " << r.tempoTotal
+              << ", \"memoriaPicoKB\": " << r.memoriaPicoKB << ", \"valida\": " << (r.valida ? "true" : "false");
+        if (!r.erro.empty()) {
+            saida << ", \"erro\": \"" << r.erro << "\"";
+        }
+        saida << ", \"objetivoNosTempos\": [";
+        for (size_t j = 0; j < r.objetivoNosTempos.size(); j++) {
+            saida << (j ? ", " : "") << r.objetivoNosTempos[j];
+        }
+        saida << "], \"curva\": [";
+        for (size_t j = 0; j < r.curva.size(); j++) {
+            saida << (j ? ", " : "") << "[" << r.curva[j].tempo << ", " << r.curva[j].objetivo << "]";
+        }
+        saida << "]}";
+    }
+    saida << "\n  ]\n}\n";
+}
+
+int compararComBase(const std::vector<ResultadoQualidade>& resultados, const std::string& arquivoBase,
+                    const ToleranciasQualidade& tolerancias, std::ostream& relatorio) {
+    std::ifstream base(arquivoBase);
+    if (!base.is_open()) {
+        throw std::runtime_error("Não foi possível abrir a linha de base: " + arquivoBase);
+    }
+
+    std::string linha;
+    if (!std::getline(base, linha)) {
+        throw std::runtime_error("Linha de base vazia: " + arquivoBase);
+    }
+    std::vector<std::string> cabecalho = dividirCsv(linha);
+    auto coluna = [&cabecalho, &arquivoBase](const std::string& nome) {
+        auto it = std::find(cabecalho.begin(), cabecalho.end(), nome);
+        if (it == cabecalho.end()) {
+            throw std::runtime_error("Coluna " + nome + " ausente na linha de base: " + arquivoBase);
+        }
+        return static_cast<size_t>(it - cabecalho.begin());
+    };
+    const size_t colInstancia = coluna("instancia");
+    const size_t colThreads = coluna("threads");
+    const size_t colObjetivo = coluna("objetivo_final");
+    const size_t colTempo = coluna("tempo_total_s");
+    const size_t colMemoria = coluna("memoria_pico_kb");
+
+    std::unordered_map<std::string, std::vector<std::string>> linhasBase;
+    while (std::getline(base, linha)) {
+        std::vector<std::string> campos = dividirCsv(linha);
+        if (campos.size() == cabecalho.size()) {
+            std::string chave = campos[colInstancia] + "@" + campos[colThreads];
+            linhasBase[chave] = std::move(campos);
+        }
+    }
+
+    int regressoes = 0;
+    for (const ResultadoQualidade& r : resultados) {
+        auto it = linhasBase.find(r.instancia + "@" + std::to_string(r.numThreads));
+        if (it == linhasBase.end()) continue;
+        const std::vector<std::string>& campos = it->second;
+
+        if (!r.valida) {
+            relatorio << "REGRESSAO " << r.instancia << ": solução inválida"
+                      << (r.erro.empty() ? "" : " (" + r.erro + ")") << "\n";
+            regressoes++;
+            continue;
+        }
+        double objetivoBase = std::stod(campos[colObjetivo]);
+        if (r.objetivoFinal < objetivoBase * (1.0 - tolerancias.objetivo)) {
+            relatorio << "REGRESSAO " << r.instancia << ": objetivo " << r.objetivoFinal << " < base "
+                      << objetivoBase << " (tolerância " << tolerancias.objetivo * 100 << "%)\n";
+            regressoes++;
+        }
+        double tempoBase = std::stod(campos[colTempo]);
+        // Tempos muito curtos são dominados por ruído; 10 ms de folga absoluta
+        if (tolerancias.tempo > 0.0 && r.tempoTotal > tempoBase * tolerancias.tempo + 0.01) {
+            relatorio << "REGRESSAO " << r.instancia << ": tempo " << r.tempoTotal << "s > base " << tempoBase
+                      << "s x " << tolerancias.tempo << "\n";
+            regressoes++;
+        }
+        double memoriaBase = std::stod(campos[colMemoria]);
+        if (tolerancias.memoria > 0.0 && r.memoriaPicoKB > memoriaBase * tolerancias.memoria) {
+            relatorio << "REGRESSAO " << r.instancia << ": memória " << r.memoriaPicoKB << " KB > base "
+                      << memoriaBase << " KB x " << tolerancias.memoria << "\n";
+            regressoes++;
+        }
+    }
+    return regressoes;
+}
@@ -0,0 +1,43 @@
+#include "cache_instancias.h"
+#include <utility>
+
+CacheInstancias::Entrada CacheInstancias::obter(const std::string& caminho, unsigned int numThreads) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entradas.find(caminho);
+        if (it != entradas.end() && it->second.instancia) return it->second;
+    }
+
+    // Carregar fora da região crítica; se outra thread carregou antes, prevalece a primeira.
+    // A entrada pode já existir sem instância quando uma solução foi registrada antes da carga
+    InstanciaPtr instancia = Instancia::carregar(caminho, numThreads);
+    std::lock_guard<std::mutex> lock(mutex);
+    Entrada& entrada = entradas[caminho];
+    if (!entrada.instancia) entrada.instancia = std::move(instancia);
+    return entrada;
+}
+
+InstanciaPtr CacheInstancias::modificar(const std::string& caminho,
+                                        const std::function<InstanciaPtr(const Instancia&)>& transformar) {
+    std::shared_ptr<std::mutex> mutexAlteracao = obterMutexAlteracao(caminho);
+    std::lock_guard<std::mutex> lockAlteracao(*mutexAlteracao);
+
+    // A transformação roda fora da região crítica do cache, só bloqueando outras alterações da entrada
+    InstanciaPtr nova = transformar(*obter(caminho).instancia);
+    std::lock_guard<std::mutex> lock(mutex);
+    entradas[caminho].instancia = nova;
+    return nova;
+}
+
+void CacheInstancias::registrarSolucao(const std::string& caminho, const Solucao& solucao) {
+    auto copia = std::make_shared<const Solucao>(solucao);
+    std::lock_guard<std::mutex> lock(mutex);
+    entradas[caminho].ultimaSolucao = std::move(copia);
+}
+
+std::shared_ptr<std::mutex> CacheInstancias::obterMutexAlteracao(const std::string& caminho) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& mutexAlteracao = mutexesAlteracao[caminho];
+    if (!mutexAlteracao) mutexAlteracao = std::make_shared<std::mutex>();
+    return mutexAlteracao;
+}
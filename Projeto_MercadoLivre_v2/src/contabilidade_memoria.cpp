@@ -0,0 +1,156 @@
+#include "contabilidade_memoria.h"
+#include "armazem.h"
+#include "localizador_itens.h"
+#include "verificador_disponibilidade.h"
+#include "analisador_relevancia.h"
+#include "agrupador_pedidos.h"
+#include "solucionar_desafio.h"
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+const char* const NOMES_CATEGORIAS[NUM_CATEGORIAS_MEMORIA] = {
+    "deposito", "backlog", "localizador", "verificador", "analisador", "agrupador", "solucoes", "areaTrabalho"
+};
+
+// Nó de std::map<int, int> (três ponteiros, cor e par) e de std::unordered_map<int, int>
+// (próximo e par), com o cabeçalho típico do malloc
+constexpr size_t BYTES_NO_MAPA = 48;
+constexpr size_t BYTES_NO_HASH = 32;
+
+thread_local ContabilidadeMemoria* contaDaThread = nullptr;
+
+template <typename T>
+size_t bytesVetor(const std::vector<T>& vetor) {
+    return vetor.capacity() * sizeof(T);
+}
+
+size_t bytesMapas(const std::vector<std::map<int, int>>& mapas) {
+    size_t bytes = bytesVetor(mapas);
+    for (const auto& mapa : mapas) {
+        bytes += mapa.size() * BYTES_NO_MAPA;
+    }
+    return bytes;
+}
+
+void atualizarPico(std::atomic<int64_t>& pico, int64_t valor) {
+    int64_t anterior = pico.load(std::memory_order_relaxed);
+    while (valor > anterior && !pico.compare_exchange_weak(anterior, valor, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+ContabilidadeMemoria::ContabilidadeMemoria(ContabilidadeMemoria* pai) : pai(pai) {
+    for (int c = 0; c < NUM_CATEGORIAS_MEMORIA; c++) {
+        atualCategoria[c].store(0, std::memory_order_relaxed);
+        picoCategoria[c].store(0, std::memory_order_relaxed);
+    }
+}
+
+ContabilidadeMemoria::~ContabilidadeMemoria() {
+    if (!pai) return;
+    for (int c = 0; c < NUM_CATEGORIAS_MEMORIA; c++) {
+        int64_t restante = atualCategoria[c].load(std::memory_order_relaxed);
+        if (restante != 0) pai->lancar(static_cast<CategoriaMemoria>(c), -restante);
+    }
+}
+
+ContabilidadeMemoria& ContabilidadeMemoria::global() {
+    static ContabilidadeMemoria conta(nullptr);
+    return conta;
+}
+
+ContabilidadeMemoria& ContabilidadeMemoria::atual() {
+    return contaDaThread ? *contaDaThread : global();
+}
+
+void ContabilidadeMemoria::lancar(CategoriaMemoria categoria, int64_t bytes) {
+    int64_t categoriaAtual = atualCategoria[categoria].fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    int64_t totalAtual = atualTotal.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    if (bytes > 0) {
+        atualizarPico(picoCategoria[categoria], categoriaAtual);
+        atualizarPico(picoTotal, totalAtual);
+    }
+    if (pai) pai->lancar(categoria, bytes);
+}
+
+UsoMemoria ContabilidadeMemoria::ler() const {
+    UsoMemoria uso;
+    for (int c = 0; c < NUM_CATEGORIAS_MEMORIA; c++) {
+        uso.atual[c] = static_cast<uint64_t>(std::max<int64_t>(0, atualCategoria[c].load(std::memory_order_relaxed)));
+        uso.pico[c] = static_cast<uint64_t>(picoCategoria[c].load(std::memory_order_relaxed));
+    }
+    uso.atualTotal = static_cast<uint64_t>(std::max<int64_t>(0, atualTotal.load(std::memory_order_relaxed)));
+    uso.picoTotal = static_cast<uint64_t>(picoTotal.load(std::memory_order_relaxed));
+    return uso;
+}
+
+VinculoMemoria::VinculoMemoria(ContabilidadeMemoria* conta) : anterior(contaDaThread) {
+    contaDaThread = conta;
+}
+
+VinculoMemoria::~VinculoMemoria() {
+    contaDaThread = anterior;
+}
+
+size_t bytesEstimados(const Deposito& deposito) {
+    return sizeof(Deposito) + bytesMapas(deposito.corredor);
+}
+
+size_t bytesEstimados(const Backlog& backlog) {
+    return sizeof(Backlog) + bytesMapas(backlog.pedido);
+}
+
+size_t bytesEstimados(const LocalizadorItens& localizador) {
+    size_t bytes = sizeof(LocalizadorItens) + bytesVetor(localizador.itemParaCorredor);
+    for (const auto& corredores : localizador.itemParaCorredor) {
+        bytes += corredores.size() * BYTES_NO_HASH + corredores.bucket_count() * sizeof(void*);
+    }
+    return bytes + bytesVetor(localizador.inicioItem) + bytesVetor(localizador.corredorOrdenado) +
+           bytesVetor(localizador.quantidadeOrdenada) + bytesVetor(localizador.inicioCorredor) +
+           bytesVetor(localizador.itemDoCorredor) + bytesVetor(localizador.quantidadeDoCorredor);
+}
+
+size_t bytesEstimados(const VerificadorDisponibilidade& verificador) {
+    return sizeof(VerificadorDisponibilidade) + bytesVetor(verificador.estoqueTotal) +
+           bytesVetor(verificador.inicioPedido) + bytesVetor(verificador.itemPedido) +
+           bytesVetor(verificador.quantidadePedido) + bytesVetor(verificador.pedidoDaEntrada) +
+           bytesVetor(verificador.pedidosAtendiveis) + bytesVetor(verificador.pedidosAtivos);
+}
+
+size_t bytesEstimados(const AnalisadorRelevancia& analisador) {
+    // O ranking (privado, calculado sob demanda) tem um inteiro por pedido
+    return sizeof(AnalisadorRelevancia) + bytesVetor(analisador.numItens) + bytesVetor(analisador.numUnidades) +
+           bytesVetor(analisador.numCorredoresMinimo) + bytesVetor(analisador.pontuacaoRelevancia) +
+           bytesVetor(analisador.ativo) + analisador.ativo.size() * sizeof(int);
+}
+
+size_t bytesEstimados(const AgrupadorPedidos& agrupador) {
+    size_t bytes = sizeof(AgrupadorPedidos) + bytesVetor(agrupador.assinaturas) +
+                   bytesVetor(agrupador.clusterDoPedido) + bytesVetor(agrupador.clusters);
+    for (const auto& cluster : agrupador.clusters) {
+        bytes += bytesVetor(cluster);
+    }
+    return bytes;
+}
+
+size_t bytesEstimados(const Solucao& solucao) {
+    return sizeof(Solucao) + solucao.pedidosWave.bytesAlocados() + bytesVetor(solucao.corredoresWave);
+}
+
+size_t bytesEstimados(const AreaTrabalhoBusca& area) {
+    return sizeof(AreaTrabalhoBusca) + area.seletor.bytesAlocados();
+}
+
+void escreverUsoMemoriaJson(std::ostream& saida, const UsoMemoria& uso) {
+    saida << "{\"atual\": " << uso.atualTotal << ", \"pico\": " << uso.picoTotal << ", \"categorias\": {";
+    for (int c = 0; c < NUM_CATEGORIAS_MEMORIA; c++) {
+        saida << (c ? ", " : "") << "\"" << NOMES_CATEGORIAS[c] << "\": {\"atual\": " << uso.atual[c]
+              << ", \"pico\": " << uso.pico[c] << "}";
+    }
+    saida << "}}";
+}
@@ -0,0 +1,115 @@
+#include "contadores_hardware.h"
+#include <cerrno>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char* const NOMES_EVENTOS[NUM_EVENTOS_HARDWARE] = {
+    "ciclos", "instrucoes", "falhasCache", "falhasDesvio"
+};
+
+} // namespace
+
+const char* nomeEventoHardware(EventoHardware evento) {
+    return NOMES_EVENTOS[evento];
+}
+
+ContadoresHardware& ContadoresHardware::daThread() {
+    thread_local ContadoresHardware contadores;
+    return contadores;
+}
+
+#ifdef __linux__
+
+namespace {
+
+const uint64_t CONFIG_EVENTOS[NUM_EVENTOS_HARDWARE] = {
+    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES
+};
+
+int abrirEvento(uint64_t config, int fdGrupo) {
+    perf_event_attr atributos;
+    std::memset(&atributos, 0, sizeof(atributos));
+    atributos.size = sizeof(atributos);
+    atributos.type = PERF_TYPE_HARDWARE;
+    atributos.config = config;
+    atributos.disabled = fdGrupo < 0 ? 1 : 0;
+    atributos.exclude_kernel = 1;
+    atributos.exclude_hv = 1;
+    atributos.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    // pid 0, cpu -1: somente a thread corrente, em qualquer CPU
+    return static_cast<int>(syscall(SYS_perf_event_open, &atributos, 0, -1, fdGrupo, 0));
+}
+
+} // namespace
+
+ContadoresHardware::ContadoresHardware() {
+    for (int e = 0; e < NUM_EVENTOS_HARDWARE; e++) {
+        fds[e] = -1;
+        posicaoNoGrupo[e] = -1;
+    }
+    // O primeiro evento que abrir lidera o grupo; os que falharem são omitidos
+    for (int e = 0; e < NUM_EVENTOS_HARDWARE; e++) {
+        fds[e] = abrirEvento(CONFIG_EVENTOS[e], fdLider);
+        if (fds[e] < 0) {
+            if (motivoIndisponivel.empty()) motivoIndisponivel = std::strerror(errno);
+            continue;
+        }
+        if (fdLider < 0) fdLider = fds[e];
+        posicaoNoGrupo[e] = numAbertos++;
+    }
+    if (fdLider < 0) {
+        return;
+    }
+    motivoIndisponivel.clear();
+    ioctl(fdLider, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(fdLider, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+ContadoresHardware::~ContadoresHardware() {
+    for (int e = 0; e < NUM_EVENTOS_HARDWARE; e++) {
+        if (fds[e] >= 0) close(fds[e]);
+    }
+}
+
+bool ContadoresHardware::ler(LeituraHardware& leitura) const {
+    if (fdLider < 0) {
+        return false;
+    }
+    // Formato do grupo: nr, tempo habilitado, tempo em execução, valores
+    uint64_t dados[3 + NUM_EVENTOS_HARDWARE];
+    ssize_t esperado = static_cast<ssize_t>((3 + numAbertos) * sizeof(uint64_t));
+    if (read(fdLider, dados, sizeof(dados)) < esperado) {
+        return false;
+    }
+    double escala = dados[2] > 0 ? static_cast<double>(dados[1]) / dados[2] : 1.0;
+    for (int e = 0; e < NUM_EVENTOS_HARDWARE; e++) {
+        leitura.valor[e] = posicaoNoGrupo[e] < 0 ? 0 :
+                           static_cast<uint64_t>(dados[3 + posicaoNoGrupo[e]] * escala);
+    }
+    return true;
+}
+
+#else
+
+ContadoresHardware::ContadoresHardware() : motivoIndisponivel("perf_event_open indisponível neste sistema") {
+    for (int e = 0; e < NUM_EVENTOS_HARDWARE; e++) {
+        fds[e] = -1;
+        posicaoNoGrupo[e] = -1;
+    }
+}
+
+ContadoresHardware::~ContadoresHardware() = default;
+
+bool ContadoresHardware::ler(LeituraHardware&) const {
+    return false;
+}
+
+#endif
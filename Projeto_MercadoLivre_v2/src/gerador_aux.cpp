@@ -0,0 +1,59 @@
+#include <fstream>
+#include <iostream>
+#include <string>
+#include "gerador_instancias.h"
+
+int main(int argc, char* argv[]) {
+    ParametrosGerador parametros;
+    std::string arquivoSaida = "-";
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string opcao = argv[i];
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("valor ausente para " + opcao);
+            }
+            std::string valor = argv[++i];
+            if (opcao == "--pedidos") parametros.numPedidos = std::stoi(valor);
+            else if (opcao == "--itens") parametros.numItens = std::stoi(valor);
+            else if (opcao == "--corredores") parametros.numCorredores = std::stoi(valor);
+            else if (opcao == "--itens-por-pedido") parametros.itensPorPedidoMedio = std::stod(valor);
+            else if (opcao == "--max-itens-por-pedido") parametros.maxItensPorPedido = std::stoi(valor);
+            else if (opcao == "--quantidade-media") parametros.quantidadeMedia = std::stod(valor);
+            else if (opcao == "--zipf") parametros.zipf = std::stod(valor);
+            else if (opcao == "--itens-por-corredor") parametros.itensPorCorredorMedio = std::stod(valor);
+            else if (opcao == "--estoque-medio") parametros.estoqueMedio = std::stod(valor);
+            else if (opcao == "--distribuicao-estoque") parametros.distribuicaoEstoque = valor;
+            else if (opcao == "--lb") parametros.LB = std::stoi(valor);
+            else if (opcao == "--ub") parametros.UB = std::stoi(valor);
+            else if (opcao == "--fracao-ub") parametros.fracaoUB = std::stod(valor);
+            else if (opcao == "--semente") parametros.semente = std::stoull(valor);
+            else if (opcao == "--saida") arquivoSaida = valor;
+            else throw std::invalid_argument("opção desconhecida: " + opcao);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Argumento inválido (" << e.what() << ")\n"
+                  << "Uso: " << argv[0] << " [--pedidos n] [--itens n] [--corredores n] [--itens-por-pedido media]\n"
+                  << "       [--max-itens-por-pedido n] [--quantidade-media media] [--zipf expoente]\n"
+                  << "       [--itens-por-corredor media] [--estoque-medio media] [--distribuicao-estoque geometrica|uniforme]\n"
+                  << "       [--lb n] [--ub n] [--fracao-ub f] [--semente n] [--saida arquivo|-]\n";
+        return 2;
+    }
+
+    try {
+        if (arquivoSaida == "-") {
+            gerarInstancia(parametros, std::cout);
+        } else {
+            std::ofstream arquivo(arquivoSaida, std::ios::binary);
+            if (!arquivo.is_open()) {
+                std::cerr << "Não foi possível criar o arquivo: " << arquivoSaida << "\n";
+                return 1;
+            }
+            gerarInstancia(parametros, arquivo);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Erro: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
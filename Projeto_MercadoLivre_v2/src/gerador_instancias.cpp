@@ -0,0 +1,201 @@
+#include "gerador_instancias.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+
+// xoshiro256** semeado por splitmix64: sequência idêntica em qualquer compilador
+class GeradorXoshiro {
+public:
+    explicit GeradorXoshiro(uint64_t semente) {
+        for (uint64_t& palavra : estado) {
+            semente += 0x9e3779b97f4a7c15ULL;
+            uint64_t z = semente;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            palavra = z ^ (z >> 31);
+        }
+    }
+
+    uint64_t proximo() {
+        uint64_t resultado = rotacionar(estado[1] * 5, 7) * 9;
+        uint64_t t = estado[1] << 17;
+        estado[2] ^= estado[0];
+        estado[3] ^= estado[1];
+        estado[1] ^= estado[2];
+        estado[0] ^= estado[3];
+        estado[2] ^= t;
+        estado[3] = rotacionar(estado[3], 45);
+        return resultado;
+    }
+
+    // Uniforme em [0, n), por rejeição: descarta os valores abaixo de 2^64 mod n, que
+    // tornariam os menores restos mais prováveis
+    uint64_t abaixoDe(uint64_t n) {
+        uint64_t limiar = (0 - n) % n;
+        uint64_t valor = proximo();
+        while (valor < limiar) {
+            valor = proximo();
+        }
+        return valor % n;
+    }
+
+    // Uniforme em [0, 1)
+    double real() {
+        return static_cast<double>(proximo() >> 11) * 0x1.0p-53;
+    }
+
+    // Geométrica em {1, 2, ...} com a média dada
+    int geometrica(double media) {
+        if (media <= 1.0) return 1;
+        double p = 1.0 / media;
+        return 1 + static_cast<int>(std::floor(std::log1p(-real()) / std::log1p(-p)));
+    }
+
+private:
+    static uint64_t rotacionar(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+    uint64_t estado[4];
+};
+
+// Amostragem de Zipf por busca binária na distribuição acumulada
+class AmostradorZipf {
+public:
+    AmostradorZipf(int n, double expoente) : acumulada(n) {
+        double soma = 0.0;
+        for (int r = 0; r < n; r++) {
+            soma += expoente == 0.0 ? 1.0 : 1.0 / std::pow(r + 1.0, expoente);
+            acumulada[r] = soma;
+        }
+        for (double& valor : acumulada) {
+            valor /= soma;
+        }
+    }
+
+    int amostrar(GeradorXoshiro& gerador) const {
+        double u = gerador.real();
+        int posto = static_cast<int>(std::upper_bound(acumulada.begin(), acumulada.end(), u) - acumulada.begin());
+        return std::min(posto, static_cast<int>(acumulada.size()) - 1);
+    }
+
+private:
+    std::vector<double> acumulada;
+};
+
+template <typename Gerador>
+void embaralhar(std::vector<int>& valores, Gerador& gerador) {
+    for (size_t i = valores.size(); i > 1; i--) {
+        std::swap(valores[i - 1], valores[gerador.abaixoDe(i)]);
+    }
+}
+
+} // namespace
+
+void gerarInstancia(const ParametrosGerador& parametros, std::ostream& saida) {
+    if (parametros.numPedidos <= 0 || parametros.numItens <= 0 || parametros.numCorredores <= 0) {
+        throw std::invalid_argument("Pedidos, itens e corredores devem ser positivos");
+    }
+    if (parametros.distribuicaoEstoque != "geometrica" && parametros.distribuicaoEstoque != "uniforme") {
+        throw std::invalid_argument("Distribuição de estoque desconhecida: " + parametros.distribuicaoEstoque);
+    }
+
+    GeradorXoshiro gerador(parametros.semente);
+    AmostradorZipf zipf(parametros.numItens, parametros.zipf);
+
+    // Posto de popularidade -> ID do item
+    std::vector<int> itemDoPosto(parametros.numItens);
+    for (int i = 0; i < parametros.numItens; i++) itemDoPosto[i] = i;
+    embaralhar(itemDoPosto, gerador);
+
+    std::string buffer;
+    buffer.reserve(1 << 20);
+    auto descarregar = [&](bool forcar) {
+        if (forcar || buffer.size() >= (1u << 20) - 256) {
+            saida.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    };
+    auto escreverNumero = [&buffer](long long valor) {
+        buffer += std::to_string(valor);
+    };
+
+    escreverNumero(parametros.numPedidos);
+    buffer += ' ';
+    escreverNumero(parametros.numItens);
+    buffer += ' ';
+    escreverNumero(parametros.numCorredores);
+    buffer += '\n';
+
+    // Pedidos: tamanho geométrico, itens distintos sorteados pela popularidade
+    const int maxItens = std::max(1, std::min(parametros.maxItensPorPedido, parametros.numItens));
+    long long totalUnidades = 0;
+    std::vector<int> itensPedido;
+    for (int p = 0; p < parametros.numPedidos; p++) {
+        int tamanho = std::min(gerador.geometrica(parametros.itensPorPedidoMedio), maxItens);
+        itensPedido.clear();
+        int tentativas = 0;
+        while (static_cast<int>(itensPedido.size()) < tamanho && tentativas++ < 20 * tamanho) {
+            int itemId = itemDoPosto[zipf.amostrar(gerador)];
+            if (std::find(itensPedido.begin(), itensPedido.end(), itemId) == itensPedido.end()) {
+                itensPedido.push_back(itemId);
+            }
+        }
+
+        escreverNumero(static_cast<long long>(itensPedido.size()));
+        for (int itemId : itensPedido) {
+            int quantidade = gerador.geometrica(parametros.quantidadeMedia);
+            totalUnidades += quantidade;
+            buffer += ' ';
+            escreverNumero(itemId);
+            buffer += ' ';
+            escreverNumero(quantidade);
+        }
+        buffer += '\n';
+        descarregar(false);
+    }
+
+    // Corredores: uma vaga por item e vagas extras proporcionais à popularidade
+    long long totalVagas = std::max<long long>(parametros.numItens,
+        std::llround(parametros.itensPorCorredorMedio * parametros.numCorredores));
+    std::vector<int> vagas;
+    vagas.reserve(static_cast<size_t>(totalVagas));
+    for (int i = 0; i < parametros.numItens; i++) vagas.push_back(i);
+    for (long long v = parametros.numItens; v < totalVagas; v++) {
+        vagas.push_back(itemDoPosto[zipf.amostrar(gerador)]);
+    }
+    embaralhar(vagas, gerador);
+
+    std::vector<int> itensCorredor;
+    for (int c = 0; c < parametros.numCorredores; c++) {
+        size_t inicio = static_cast<size_t>(totalVagas * c / parametros.numCorredores);
+        size_t fim = static_cast<size_t>(totalVagas * (c + 1) / parametros.numCorredores);
+        itensCorredor.assign(vagas.begin() + inicio, vagas.begin() + fim);
+        std::sort(itensCorredor.begin(), itensCorredor.end());
+        itensCorredor.erase(std::unique(itensCorredor.begin(), itensCorredor.end()), itensCorredor.end());
+
+        escreverNumero(static_cast<long long>(itensCorredor.size()));
+        for (int itemId : itensCorredor) {
+            int estoque = parametros.distribuicaoEstoque == "uniforme"
+                ? 1 + static_cast<int>(gerador.abaixoDe(static_cast<uint64_t>(
+                      std::max(1.0, 2.0 * parametros.estoqueMedio - 1.0))))
+                : gerador.geometrica(parametros.estoqueMedio);
+            buffer += ' ';
+            escreverNumero(itemId);
+            buffer += ' ';
+            escreverNumero(estoque);
+        }
+        buffer += '\n';
+        descarregar(false);
+    }
+
+    // Limites da wave
+    long long UB = parametros.UB >= 0 ? parametros.UB
+                                      : std::max<long long>(1, std::llround(parametros.fracaoUB * totalUnidades));
+    long long LB = parametros.LB >= 0 ? parametros.LB : std::max<long long>(1, UB / 2);
+    escreverNumero(LB);
+    buffer += ' ';
+    escreverNumero(UB);
+    buffer += '\n';
+    descarregar(true);
+}
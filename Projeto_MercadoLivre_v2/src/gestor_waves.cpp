@@ -1,31 +1,23 @@
 #include "gestor_waves.h"
+#include <utility>
 
-GestorWaves::GestorWaves(const Deposito& dep, const Backlog& back) 
-    : deposito(dep), 
-      backlog(back),
-      localizador(dep.numItens),
-      verificador(dep.numItens),
-      analisador(back.numPedidos) {
-    
-    // Inicializar estruturas auxiliares
-    localizador.construir(deposito);
-    verificador.construir(deposito);
-    analisador.construir(backlog, localizador);
-}
+GestorWaves::GestorWaves(InstanciaPtr inst) 
+    : instancia(std::move(inst)) {}
 
 SeletorWaves::WaveCandidata GestorWaves::selecionarMelhorWave() {
-    std::vector<int> pedidosOrdenados = analisador.getPedidosOrdenadosPorRelevancia();
-    return seletor.selecionarWaveOtima(backlog, pedidosOrdenados, analisador, localizador);
+    const AnalisadorRelevancia& analisador = instancia->getAnalisador();
+    return seletor.selecionarWaveOtima(instancia->getBacklog(), analisador.getPedidosOrdenadosPorRelevancia(), analisador,
+                                       instancia->getLocalizador());
 }
 
 bool GestorWaves::verificarPedido(int pedidoId) {
-    return verificador.verificarDisponibilidade(backlog.pedido[pedidoId]);
+    return instancia->getVerificador().pedidoAtendivel(pedidoId);
 }
 
 AnalisadorRelevancia::InfoPedido GestorWaves::getInfoPedido(int pedidoId) {
-    return analisador.infoPedidos[pedidoId];
+    return instancia->getAnalisador().getInfoPedido(pedidoId);
 }
 
 const std::unordered_map<int, int>& GestorWaves::getCorredoresComItem(int itemId) {
-    return localizador.getCorredoresComItem(itemId);
-}
\ No newline at end of file
+    return instancia->getLocalizador().getCorredoresComItem(itemId);
+}
@@ -0,0 +1,64 @@
+#include "instancia.h"
+#include <utility>
+#include "parser.h"
+#include "instrumentacao.h"
+
+Instancia::Instancia(Deposito dep, Backlog back, unsigned int numThreads)
+    : deposito(std::move(dep)), backlog(std::move(back)), numThreads(numThreads) {
+    memoria.lancar(MEMORIA_DEPOSITO, bytesEstimados(deposito));
+    memoria.lancar(MEMORIA_BACKLOG, bytesEstimados(backlog));
+}
+
+InstanciaPtr Instancia::carregar(const std::string& filePath, unsigned int numThreads) {
+    INSTRUMENTAR_FASE(FASE_LEITURA);
+    InputParser parser;
+    auto [deposito, backlog] = parser.parseFile(filePath);
+    return criar(std::move(deposito), std::move(backlog), numThreads);
+}
+
+InstanciaPtr Instancia::criar(Deposito deposito, Backlog backlog, unsigned int numThreads) {
+    return InstanciaPtr(new Instancia(std::move(deposito), std::move(backlog), numThreads));
+}
+
+const LocalizadorItens& Instancia::getLocalizador() const {
+    std::call_once(flagLocalizador, [this]() {
+        INSTRUMENTAR_FASE(FASE_INDICES);
+        localizador = std::make_unique<LocalizadorItens>(deposito.numItens);
+        localizador->construir(deposito);
+        memoria.lancar(MEMORIA_LOCALIZADOR, bytesEstimados(*localizador));
+    });
+    return *localizador;
+}
+
+const VerificadorDisponibilidade& Instancia::getVerificador() const {
+    std::call_once(flagVerificador, [this]() {
+        INSTRUMENTAR_FASE(FASE_INDICES);
+        verificador = std::make_unique<VerificadorDisponibilidade>(deposito.numItens);
+        verificador->construir(deposito);
+        verificador->indexarPedidos(backlog, numThreads);
+        memoria.lancar(MEMORIA_VERIFICADOR, bytesEstimados(*verificador));
+    });
+    return *verificador;
+}
+
+const AnalisadorRelevancia& Instancia::getAnalisador() const {
+    std::call_once(flagAnalisador, [this]() {
+        const LocalizadorItens& loc = getLocalizador();
+        INSTRUMENTAR_FASE(FASE_RELEVANCIA);
+        analisador = std::make_unique<AnalisadorRelevancia>(backlog.numPedidos);
+        analisador->construir(backlog, loc, numThreads);
+        memoria.lancar(MEMORIA_ANALISADOR, bytesEstimados(*analisador));
+    });
+    return *analisador;
+}
+
+const AgrupadorPedidos& Instancia::getAgrupador() const {
+    std::call_once(flagAgrupador, [this]() {
+        const LocalizadorItens& loc = getLocalizador();
+        INSTRUMENTAR_FASE(FASE_INDICES);
+        agrupador = std::make_unique<AgrupadorPedidos>(backlog.numPedidos);
+        agrupador->construir(backlog, loc);
+        memoria.lancar(MEMORIA_AGRUPADOR, bytesEstimados(*agrupador));
+    });
+    return *agrupador;
+}
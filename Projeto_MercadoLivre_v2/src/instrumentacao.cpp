@@ -0,0 +1,85 @@
+#include "instrumentacao.h"
+
+#ifdef MERCADOLIVRE_INSTRUMENTACAO
+
+thread_local BlocoMetricas* blocoInstrumentacaoAtual = nullptr;
+thread_local RegistroInstrumentacao* registroInstrumentacaoAtual = nullptr;
+
+namespace {
+
+const char* const NOMES_FASES[NUM_FASES] = {
+    "leitura", "indices", "relevancia", "construcao", "otimizacao", "ajuste", "escrita"
+};
+
+const char* const NOMES_CONTADORES[NUM_CONTADORES] = {
+    "perturbacoes", "movimentosAvaliados", "reconstrucoesCorredores", "melhorias"
+};
+
+} // namespace
+
+BlocoMetricas* RegistroInstrumentacao::blocoDaThread() {
+    std::lock_guard<std::mutex> lock(mutex);
+    BlocoMetricas*& bloco = blocoPorThread[std::this_thread::get_id()];
+    if (!bloco) {
+        blocos.emplace_back();
+        bloco = &blocos.back();
+    }
+    return bloco;
+}
+
+void RegistroInstrumentacao::escreverJson(std::ostream& saida, const std::string& instancia) const {
+    BlocoMetricas total;
+    size_t numBlocos;
+    std::string motivoHardware;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        numBlocos = blocos.size();
+        for (const BlocoMetricas& bloco : blocos) {
+            for (int f = 0; f < NUM_FASES; f++) {
+                total.tempoNs[f] += bloco.tempoNs[f];
+                total.chamadas[f] += bloco.chamadas[f];
+            }
+            for (int c = 0; c < NUM_CONTADORES; c++) {
+                total.contadores[c] += bloco.contadores[c];
+            }
+            for (int f = 0; f < NUM_FASES; f++) {
+                for (int e = 0; e < NUM_EVENTOS_HARDWARE; e++) {
+                    total.hardware[f][e] += bloco.hardware[f][e];
+                }
+            }
+            total.hardwareLido = total.hardwareLido || bloco.hardwareLido;
+            // O motivo vem das threads que tentaram abrir os contadores, não da que escreve o JSON
+            if (motivoHardware.empty()) motivoHardware = bloco.motivoHardware;
+        }
+    }
+
+    saida << "{\n  \"instancia\": \"" << instancia << "\",\n  \"threads\": " << numBlocos << ",\n";
+#ifdef MERCADOLIVRE_CONTADORES_HARDWARE
+    saida << "  \"contadoresHardware\": ";
+    if (total.hardwareLido) {
+        saida << "\"disponivel\",\n";
+    } else {
+        saida << "\"indisponivel" << (motivoHardware.empty() ? "" : ": " + motivoHardware) << "\",\n";
+    }
+#endif
+    saida << "  \"fases\": {";
+    for (int f = 0; f < NUM_FASES; f++) {
+        saida << (f ? ",\n" : "\n") << "    \"" << NOMES_FASES[f] << "\": {\"ms\": " << total.tempoNs[f] / 1e6
+              << ", \"chamadas\": " << total.chamadas[f];
+        if (total.hardwareLido) {
+            for (int e = 0; e < NUM_EVENTOS_HARDWARE; e++) {
+                saida << ", \"" << nomeEventoHardware(static_cast<EventoHardware>(e)) << "\": " << total.hardware[f][e];
+            }
+            uint64_t ciclos = total.hardware[f][EVENTO_CICLOS];
+            saida << ", \"ipc\": " << (ciclos ? static_cast<double>(total.hardware[f][EVENTO_INSTRUCOES]) / ciclos : 0.0);
+        }
+        saida << "}";
+    }
+    saida << "\n  },\n  \"contadores\": {";
+    for (int c = 0; c < NUM_CONTADORES; c++) {
+        saida << (c ? ",\n" : "\n") << "    \"" << NOMES_CONTADORES[c] << "\": " << total.contadores[c];
+    }
+    saida << "\n  }\n}\n";
+}
+
+#endif
@@ -0,0 +1,155 @@
+#include "linha_comando.h"
+#include "solucionar_desafio.h"
+#include "cache_instancias.h"
+#include "validar_resultados.h"
+#include "rastreamento.h"
+#include "contabilidade_memoria.h"
+#include <chrono>
+#include <fstream>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+void mostrarAjuda(const char* programa) {
+    std::cout << "Uso: " << programa << " [opções]\n"
+              << "  --entrada <dir|arquivo>   Instâncias (.txt) a resolver (padrão: data/input)\n"
+              << "  --saida <dir>             Diretório dos arquivos .sol (padrão: data/output)\n"
+              << "  --threads <n>             Threads no total (padrão: hardware_concurrency)\n"
+              << "  --tempo <segundos>        Tempo limite por instância (padrão: sem limite)\n"
+              << "  --algoritmo <nome>        completo, guloso ou janela (padrão: completo)\n"
+              << "  --semente <n>             Semente do gerador aleatório (padrão: não determinística)\n"
+              << "  --iteracoes <n>           Perturbações da busca local (padrão: 100)\n"
+              << "  --afinidade <modo>        nenhuma, no (instâncias e threads por nó NUMA) ou cpu\n"
+              << "                            (como no, com uma CPU por thread da busca; padrão: nenhuma)\n"
+              << "  --nos-numa <n>            Nós NUMA usados pela afinidade (padrão: todos)\n"
+              << "  --deterministico          Resultado idêntico para a mesma semente e número de threads\n"
+              << "                            (usa --semente, ou 1; ignora --tempo)\n"
+              << "  --rastreamento <arquivo>  Grava a linha do tempo das threads (Chrome trace JSON)\n"
+              << "  --validar                 Valida as soluções e grava <saida>/validacao.json\n"
+              << "  --ajuda                   Mostra esta mensagem\n"
+              << "Sem argumentos, o programa abre o menu interativo.\n";
+}
+
+} // namespace
+
+int executarLinhaComando(int argc, char* argv[]) {
+    std::string diretorioEntrada = "data/input";
+    std::string diretorioSaida = "data/output";
+    ConfiguracaoSolver configuracao;
+    bool validar = false;
+    std::string arquivoRastreamento;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string opcao = argv[i];
+            if (opcao == "--ajuda" || opcao == "-h") {
+                mostrarAjuda(argv[0]);
+                return 0;
+            }
+            if (opcao == "--validar") {
+                validar = true;
+                continue;
+            }
+            if (opcao == "--deterministico") {
+                configuracao.deterministico = true;
+                continue;
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("valor ausente para " + opcao);
+            }
+            std::string valor = argv[++i];
+
+            if (opcao == "--entrada") {
+                diretorioEntrada = valor;
+            } else if (opcao == "--saida") {
+                diretorioSaida = valor;
+            } else if (opcao == "--threads") {
+                configuracao.numThreads = static_cast<unsigned int>(std::stoul(valor));
+            } else if (opcao == "--tempo") {
+                configuracao.tempoLimite = std::stod(valor);
+            } else if (opcao == "--algoritmo") {
+                if (valor != "completo" && valor != "guloso" && valor != "janela") {
+                    throw std::invalid_argument("algoritmo desconhecido: " + valor);
+                }
+                configuracao.algoritmo = valor;
+            } else if (opcao == "--semente") {
+                configuracao.semente = std::stoull(valor);
+            } else if (opcao == "--iteracoes") {
+                configuracao.maxIteracoes = std::stoi(valor);
+            } else if (opcao == "--afinidade") {
+                if (valor != "nenhuma" && valor != "no" && valor != "cpu") {
+                    throw std::invalid_argument("afinidade desconhecida: " + valor);
+                }
+                configuracao.afinidade = valor;
+            } else if (opcao == "--nos-numa") {
+                configuracao.nosNuma = std::stoi(valor);
+            } else if (opcao == "--rastreamento") {
+                arquivoRastreamento = valor;
+            } else {
+                throw std::invalid_argument("opção desconhecida: " + opcao);
+            }
+        }
+        if (configuracao.tempoLimite < 0.0 || configuracao.maxIteracoes < 0 || configuracao.nosNuma < 0) {
+            throw std::invalid_argument("tempo, iterações e nós não podem ser negativos");
+        }
+        if (configuracao.deterministico) {
+            if (configuracao.semente == 0) configuracao.semente = 1;
+            if (configuracao.tempoLimite > 0.0) {
+                std::cerr << "Aviso: --tempo é ignorado no modo determinístico\n";
+            }
+        }
+        if (!std::filesystem::exists(diretorioEntrada)) {
+            throw std::invalid_argument("entrada inexistente: " + diretorioEntrada);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Argumento inválido (" << e.what() << "). Use --ajuda para ver as opções.\n";
+        return 2;
+    }
+
+    // Com --validar, o cache guarda as instâncias lidas pelo solver para que a validação não as
+    // releia; sem ele, cada instância é liberada assim que sua solução é escrita
+    bool validarLoteEntrada = validar && std::filesystem::is_directory(diretorioEntrada);
+    std::unique_ptr<CacheInstancias> cache;
+    if (validarLoteEntrada) {
+        cache = std::make_unique<CacheInstancias>();
+    }
+    if (!arquivoRastreamento.empty()) {
+        RastreadorEventos::iniciar();
+    }
+    auto resumos = solucionarDesafio(diretorioEntrada, diretorioSaida, configuracao, cache.get());
+    if (!arquivoRastreamento.empty() && !RastreadorEventos::finalizar(arquivoRastreamento)) {
+        std::cerr << "Erro ao gravar o rastreamento em " << arquivoRastreamento << std::endl;
+    }
+
+    int falhas = 0;
+    double somaObjetivos = 0.0;
+    for (const auto& resumo : resumos) {
+        if (!resumo.sucesso) falhas++;
+        somaObjetivos += resumo.valorObjetivo;
+    }
+    std::cout << "TOTAL instancias=" << resumos.size() << " falhas=" << falhas
+              << " soma_objetivos=" << somaObjetivos << std::endl;
+    std::cout << "MEMORIA pico_kb=" << ContabilidadeMemoria::global().ler().picoTotal / 1024
+              << " (detalhes em " << diretorioSaida << "/memoria.json)" << std::endl;
+
+    if (validarLoteEntrada) {
+        auto inicio = std::chrono::steady_clock::now();
+        auto relatorios = validarLote(diretorioEntrada, diretorioSaida, *cache, configuracao.numThreads);
+        double tempoMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+
+        int reprovadas = 0;
+        for (const auto& relatorio : relatorios) {
+            if (!relatorio.valida) reprovadas++;
+        }
+        std::ofstream json(diretorioSaida + "/validacao.json");
+        escreverRelatorioJson(relatorios, json);
+        std::cout << "VALIDACAO solucoes=" << relatorios.size() << " reprovadas=" << reprovadas
+                  << " tempo_ms=" << tempoMs << std::endl;
+        falhas += reprovadas;
+    }
+    return falhas == 0 ? 0 : 1;
+}
@@ -1,13 +1,122 @@
 #include "localizador_itens.h"
+#include <algorithm>
+#include <numeric>
 
 void LocalizadorItens::construir(const Deposito& deposito) {
+    numCorredores = deposito.numCorredores;
+    const int numItens = static_cast<int>(itemParaCorredor.size());
+    
+    std::fill(inicioItem.begin(), inicioItem.end(), 0);
     for (int corredorId = 0; corredorId < deposito.numCorredores; corredorId++) {
         for (const auto& [itemId, quantidade] : deposito.corredor[corredorId]) {
             itemParaCorredor[itemId][corredorId] = quantidade;
+            inicioItem[itemId + 1]++;
+        }
+    }
+    
+    // Montar o CSR corredor -> itens (std::map já entrega os itens em ordem crescente)
+    inicioCorredor.assign(deposito.numCorredores + 1, 0);
+    itemDoCorredor.clear();
+    quantidadeDoCorredor.clear();
+    for (int corredorId = 0; corredorId < deposito.numCorredores; corredorId++) {
+        for (const auto& [itemId, quantidade] : deposito.corredor[corredorId]) {
+            itemDoCorredor.push_back(itemId);
+            quantidadeDoCorredor.push_back(quantidade);
+        }
+        inicioCorredor[corredorId + 1] = static_cast<int>(itemDoCorredor.size());
+    }
+    
+    // Montar o CSR item -> corredores
+    std::partial_sum(inicioItem.begin(), inicioItem.end(), inicioItem.begin());
+    corredorOrdenado.assign(inicioItem[numItens], 0);
+    quantidadeOrdenada.assign(inicioItem[numItens], 0);
+    
+    std::vector<int> proximo(inicioItem.begin(), inicioItem.end() - 1);
+    for (int corredorId = 0; corredorId < deposito.numCorredores; corredorId++) {
+        for (const auto& [itemId, quantidade] : deposito.corredor[corredorId]) {
+            corredorOrdenado[proximo[itemId]] = corredorId;
+            quantidadeOrdenada[proximo[itemId]] = quantidade;
+            proximo[itemId]++;
+        }
+    }
+    
+    // Ordenar cada item por quantidade (decrescente), desempatando pelo ID do corredor
+    std::vector<std::pair<int, int>> segmento;
+    for (int itemId = 0; itemId < numItens; itemId++) {
+        int inicio = inicioItem[itemId];
+        int fim = inicioItem[itemId + 1];
+        segmento.clear();
+        for (int k = inicio; k < fim; k++) {
+            segmento.emplace_back(quantidadeOrdenada[k], corredorOrdenado[k]);
+        }
+        std::sort(segmento.begin(), segmento.end(),
+            [](const auto& a, const auto& b) {
+                return a.first != b.first ? a.first > b.first : a.second < b.second;
+            });
+        for (int k = inicio; k < fim; k++) {
+            quantidadeOrdenada[k] = segmento[k - inicio].first;
+            corredorOrdenado[k] = segmento[k - inicio].second;
         }
     }
 }
 
 const std::unordered_map<int, int>& LocalizadorItens::getCorredoresComItem(int itemId) const {
     return itemParaCorredor[itemId];
-}
\ No newline at end of file
+}
+
+std::vector<int> LocalizadorItens::getCorredoresPedido(const std::map<int, int>& pedido) const {
+    std::vector<int> corredores;
+    
+    for (const auto& [itemId, quantidadeSolicitada] : pedido) {
+        int quantidadeRestante = quantidadeSolicitada;
+        for (int k = inicioItem[itemId]; 
+             k < inicioItem[itemId + 1] && quantidadeRestante > 0 && quantidadeOrdenada[k] > 0; k++) {
+            corredores.push_back(corredorOrdenado[k]);
+            quantidadeRestante -= std::min(quantidadeRestante, quantidadeOrdenada[k]);
+        }
+    }
+    
+    std::sort(corredores.begin(), corredores.end());
+    corredores.erase(std::unique(corredores.begin(), corredores.end()), corredores.end());
+    return corredores;
+}
+
+void LocalizadorItens::atualizarEstoque(int corredorId, int itemId, int novaQuantidade) {
+    if (novaQuantidade > 0) {
+        itemParaCorredor[itemId][corredorId] = novaQuantidade;
+    } else {
+        itemParaCorredor[itemId].erase(corredorId);
+    }
+    
+    // CSR corredor -> itens: itens em ordem crescente, busca binária
+    auto primeiro = itemDoCorredor.begin() + inicioCorredor[corredorId];
+    auto ultimo = itemDoCorredor.begin() + inicioCorredor[corredorId + 1];
+    auto it = std::lower_bound(primeiro, ultimo, itemId);
+    if (it == ultimo || *it != itemId) return;
+    quantidadeDoCorredor[it - itemDoCorredor.begin()] = std::max(0, novaQuantidade);
+    
+    // CSR item -> corredores: atualizar e reposicionar a entrada para manter a ordem decrescente
+    int inicio = inicioItem[itemId];
+    int fim = inicioItem[itemId + 1];
+    int k = inicio;
+    while (k < fim && corredorOrdenado[k] != corredorId) k++;
+    if (k == fim) return;
+    quantidadeOrdenada[k] = std::max(0, novaQuantidade);
+    
+    auto antes = [this](int a, int b) {
+        return quantidadeOrdenada[a] != quantidadeOrdenada[b] ? 
+               quantidadeOrdenada[a] > quantidadeOrdenada[b] : corredorOrdenado[a] < corredorOrdenado[b];
+    };
+    auto trocar = [this](int a, int b) {
+        std::swap(quantidadeOrdenada[a], quantidadeOrdenada[b]);
+        std::swap(corredorOrdenado[a], corredorOrdenado[b]);
+    };
+    while (k > inicio && antes(k, k - 1)) {
+        trocar(k, k - 1);
+        k--;
+    }
+    while (k + 1 < fim && antes(k + 1, k)) {
+        trocar(k, k + 1);
+        k++;
+    }
+}
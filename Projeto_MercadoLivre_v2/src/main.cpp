@@ -1,11 +1,18 @@
 #include <iostream>
 #include "menu.h"
+#include "linha_comando.h"
 
 /**
  * @brief Função principal do programa
+ * @param argc Número de argumentos
+ * @param argv Argumentos (com qualquer argumento, executa em lote sem o menu)
  * @return Código de saída (0 = sucesso)
  */
-int main() {
+int main(int argc, char* argv[]) {
+    if (argc > 1) {
+        return executarLinhaComando(argc, argv);
+    }
+    
     std::cout << "Projeto MercadoLivre v2 - SBPO 2025\n";
     std::cout << "Sistema de Otimização de Waves para Processamento de Pedidos\n\n";
     
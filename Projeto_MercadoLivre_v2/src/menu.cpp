@@ -7,6 +7,9 @@
 #include "solucionar_desafio.h"
 #include "validar_resultados.h"
 #include "desafio_info.h"
+#include "instancia.h"
+#include "planejador_waves.h"
+#include "partida_quente.h"
 
 void mostrarMenu() {
     std::cout << "\n===== Menu Principal =====\n";
@@ -15,6 +18,8 @@ void mostrarMenu() {
     std::cout << "3. Solucionar o desafio\n";
     std::cout << "4. Validar resultados\n";
     std::cout << "5. Exibir informações do desafio\n";
+    std::cout << "6. Planejar múltiplas waves\n";
+    std::cout << "7. Reotimizar a partir de uma solução anterior\n";
     std::cout << "0. Sair\n";
     std::cout << "=========================\n";
 }
@@ -107,6 +112,51 @@ void processarEscolhaMenu(int choice) {
         case 5:
             exibirInformacoesDesafio();
             break;
+        case 6:
+            {
+                std::string arquivoSelecionado = selecionarArquivoInstancia();
+                if (arquivoSelecionado.empty()) {
+                    break;
+                }
+                
+                int maxWaves;
+                std::cout << "Número máximo de waves (0 = até esgotar): ";
+                std::cin >> maxWaves;
+                
+                try {
+                    PlanejadorWaves planejador(Instancia::carregar(arquivoSelecionado));
+                    std::string nomeArquivo = std::filesystem::path(arquivoSelecionado).filename().string();
+                    int waves = planejador.planejar("data/output", nomeArquivo, maxWaves);
+                    std::cout << waves << " wave(s) planejada(s); " << planejador.getNumPedidosRestantes()
+                              << " pedidos permanecem no backlog.\n";
+                } catch (const std::exception& e) {
+                    std::cerr << "Erro ao planejar waves: " << e.what() << std::endl;
+                }
+            }
+            break;
+        case 7:
+            {
+                std::string arquivoSelecionado = selecionarArquivoInstancia();
+                if (arquivoSelecionado.empty()) {
+                    break;
+                }
+                
+                std::string arquivoSolucao, arquivoDelta;
+                std::cout << "Arquivo .sol anterior: ";
+                std::cin >> arquivoSolucao;
+                std::cout << "Arquivo de alterações (- para nenhum): ";
+                std::cin >> arquivoDelta;
+                if (arquivoDelta == "-") {
+                    arquivoDelta.clear();
+                }
+                
+                try {
+                    processarPartidaQuente(arquivoSelecionado, arquivoSolucao, arquivoDelta, "data/output");
+                } catch (const std::exception& e) {
+                    std::cerr << "Erro ao reotimizar: " << e.what() << std::endl;
+                }
+            }
+            break;
         default:
             std::cout << "Opção inválida. Tente novamente.\n";
             break;
@@ -0,0 +1,85 @@
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "instancia.h"
+#include "solucionar_desafio.h"
+#include "wave_online.h"
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Uso: " << argv[0] << " <arquivo_instancia> [arquivo_eventos|-] [--seguir] [--saida <diretorio>]\n";
+        return 1;
+    }
+    
+    std::string arquivoInstancia = argv[1];
+    std::string arquivoEventos = "-";
+    std::string diretorioSaida = "data/output";
+    bool seguir = false;
+    for (int i = 2; i < argc; i++) {
+        std::string argumento = argv[i];
+        if (argumento == "--seguir") {
+            seguir = true;
+        } else if (argumento == "--saida" && i + 1 < argc) {
+            diretorioSaida = argv[++i];
+        } else {
+            arquivoEventos = argumento;
+        }
+    }
+    
+    try {
+        WaveOnline online(Instancia::carregar(arquivoInstancia));
+        
+        std::ifstream arquivo;
+        if (arquivoEventos != "-") {
+            arquivo.open(arquivoEventos);
+            if (!arquivo.is_open()) {
+                std::cerr << "Não foi possível abrir o arquivo de eventos: " << arquivoEventos << "\n";
+                return 1;
+            }
+        }
+        std::istream& eventos = arquivoEventos == "-" ? std::cin : arquivo;
+        
+        std::string linha;
+        int numEventos = 0;
+        while (true) {
+            if (!std::getline(eventos, linha)) {
+                // Em modo --seguir, aguardar novas linhas no fim do arquivo (como tail -f)
+                if (!seguir || arquivoEventos == "-") break;
+                eventos.clear();
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                continue;
+            }
+            
+            auto inicio = std::chrono::steady_clock::now();
+            try {
+                if (!online.processarEvento(linha)) continue;
+            } catch (const std::exception& e) {
+                std::cerr << "Evento ignorado (" << e.what() << "): " << linha << "\n";
+                continue;
+            }
+            double micros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - inicio).count();
+            
+            Solucao wave = online.getWave();
+            std::cout << "evento " << ++numEventos << " (" << micros << " us): wave com "
+                      << wave.pedidosWave.size() << " pedidos, " << wave.corredoresWave.size()
+                      << " corredores, objetivo " << wave.valorObjetivo
+                      << (online.waveValida() ? "" : " [abaixo do LB]") << "\n";
+        }
+        
+        online.aguardarOtimizacao();
+        Solucao wave = online.getWave();
+        std::cout << "Wave final: " << wave.pedidosWave.size() << " pedidos, " << wave.corredoresWave.size()
+                  << " corredores, objetivo " << wave.valorObjetivo << "\n";
+        std::filesystem::create_directories(diretorioSaida);
+        std::string nomeArquivo = arquivoInstancia.substr(arquivoInstancia.find_last_of("/\\") + 1);
+        salvarSolucao(diretorioSaida, nomeArquivo, wave);
+    } catch (const std::exception& e) {
+        std::cerr << "Erro: " << e.what() << "\n";
+        return 1;
+    }
+    
+    return 0;
+}
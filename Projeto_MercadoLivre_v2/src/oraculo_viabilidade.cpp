@@ -0,0 +1,128 @@
+#include "oraculo_viabilidade.h"
+#include <algorithm>
+
+OraculoViabilidade::OraculoViabilidade(const Deposito& deposito, const Backlog& backlog)
+    : deposito(deposito), backlog(backlog),
+      demanda(deposito.numItens, 0), oferta(deposito.numItens, 0),
+      pedidoNaWave(backlog.numPedidos, 0), corredorAberto(deposito.numCorredores, 0) {}
+
+void OraculoViabilidade::atualizarItem(int itemId, int demandaAnterior, int ofertaAnterior) {
+    bool estavaEmDeficit = demandaAnterior > ofertaAnterior;
+    bool estaEmDeficit = demanda[itemId] > oferta[itemId];
+    itensEmDeficit += static_cast<int>(estaEmDeficit) - static_cast<int>(estavaEmDeficit);
+}
+
+void OraculoViabilidade::adicionarPedido(int pedidoId) {
+    if (pedidoNaWave[pedidoId]) return;
+    pedidoNaWave[pedidoId] = 1;
+    for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
+        int anterior = demanda[itemId];
+        demanda[itemId] += quantidade;
+        atualizarItem(itemId, anterior, oferta[itemId]);
+    }
+}
+
+void OraculoViabilidade::removerPedido(int pedidoId) {
+    if (!pedidoNaWave[pedidoId]) return;
+    pedidoNaWave[pedidoId] = 0;
+    for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
+        int anterior = demanda[itemId];
+        demanda[itemId] -= quantidade;
+        atualizarItem(itemId, anterior, oferta[itemId]);
+    }
+}
+
+void OraculoViabilidade::abrirCorredor(int corredorId) {
+    if (corredorAberto[corredorId]) return;
+    corredorAberto[corredorId] = 1;
+    for (const auto& [itemId, quantidade] : deposito.corredor[corredorId]) {
+        int anterior = oferta[itemId];
+        oferta[itemId] += quantidade;
+        atualizarItem(itemId, demanda[itemId], anterior);
+    }
+}
+
+void OraculoViabilidade::fecharCorredor(int corredorId) {
+    if (!corredorAberto[corredorId]) return;
+    corredorAberto[corredorId] = 0;
+    for (const auto& [itemId, quantidade] : deposito.corredor[corredorId]) {
+        int anterior = oferta[itemId];
+        oferta[itemId] -= quantidade;
+        atualizarItem(itemId, demanda[itemId], anterior);
+    }
+}
+
+bool OraculoViabilidade::cabeNoEstoque(int pedidoId, const std::vector<int>& estoque) const {
+    for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
+        if (demanda[itemId] + quantidade > estoque[itemId]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool OraculoViabilidade::podeFecharCorredor(int corredorId) const {
+    for (const auto& [itemId, quantidade] : deposito.corredor[corredorId]) {
+        if (demanda[itemId] > 0 && oferta[itemId] - quantidade < demanda[itemId]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool OraculoViabilidade::completarCorredores(const LocalizadorItens& localizador) {
+    for (int itemId = 0; itemId < deposito.numItens && itensEmDeficit > 0; itemId++) {
+        for (int k = localizador.inicioItem[itemId]; 
+             k < localizador.inicioItem[itemId + 1] && demanda[itemId] > oferta[itemId] &&
+             localizador.quantidadeOrdenada[k] > 0; k++) {
+            abrirCorredor(localizador.corredorOrdenado[k]);
+        }
+    }
+    return viavel();
+}
+
+void OraculoViabilidade::reduzirCorredores() {
+    // Contribuição útil de cada corredor aberto: unidades que ele pode fornecer à wave
+    std::vector<std::pair<long long, int>> candidatos;
+    for (int corredorId = 0; corredorId < deposito.numCorredores; corredorId++) {
+        if (!corredorAberto[corredorId]) continue;
+        long long contribuicao = 0;
+        for (const auto& [itemId, quantidade] : deposito.corredor[corredorId]) {
+            contribuicao += std::min(quantidade, demanda[itemId]);
+        }
+        candidatos.emplace_back(contribuicao, corredorId);
+    }
+    std::sort(candidatos.begin(), candidatos.end());
+    
+    for (const auto& [contribuicao, corredorId] : candidatos) {
+        if (podeFecharCorredor(corredorId)) {
+            fecharCorredor(corredorId);
+        }
+    }
+}
+
+std::vector<OraculoViabilidade::Atribuicao> OraculoViabilidade::atribuirEstoque(
+    const LocalizadorItens& localizador) const {
+    std::vector<Atribuicao> atribuicoes;
+    for (int itemId = 0; itemId < deposito.numItens; itemId++) {
+        int restante = demanda[itemId];
+        for (int k = localizador.inicioItem[itemId]; 
+             k < localizador.inicioItem[itemId + 1] && restante > 0 &&
+             localizador.quantidadeOrdenada[k] > 0; k++) {
+            int corredorId = localizador.corredorOrdenado[k];
+            if (!corredorAberto[corredorId]) continue;
+            int quantidade = std::min(restante, localizador.quantidadeOrdenada[k]);
+            atribuicoes.push_back({corredorId, itemId, quantidade});
+            restante -= quantidade;
+        }
+    }
+    return atribuicoes;
+}
+
+std::vector<int> OraculoViabilidade::getCorredoresAbertos() const {
+    std::vector<int> corredores;
+    for (int corredorId = 0; corredorId < deposito.numCorredores; corredorId++) {
+        if (corredorAberto[corredorId]) corredores.push_back(corredorId);
+    }
+    return corredores;
+}
@@ -6,6 +6,7 @@
 #include <stdexcept>
 #include <vector>
 #include <unordered_set>
+#include <utility>
 
 bool validarInstancia(const Deposito& deposito, const Backlog& backlog) {
     std::cout << "Validando instância carregada..." << std::endl;
@@ -205,5 +206,5 @@ std::pair<Deposito, Backlog> InputParser::parseFile(const std::string& filePath)
         throw std::runtime_error("Instância inválida após parser: " + filePath);
     }
     
-    return std::make_pair(deposito, backlog);
+    return {std::move(deposito), std::move(backlog)};
 }
\ No newline at end of file
@@ -0,0 +1,163 @@
+#include "partida_quente.h"
+#include "parser.h"
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+void aplicarDelta(Deposito& deposito, Backlog& backlog, const std::string& arquivoDelta) {
+    std::ifstream file(arquivoDelta);
+    if (!file.is_open()) {
+        throw std::runtime_error("Não foi possível abrir o arquivo de alterações: " + arquivoDelta);
+    }
+    aplicarDelta(deposito, backlog, file);
+}
+
+void aplicarDelta(Deposito& deposito, Backlog& backlog, std::istream& file) {
+    std::string line;
+    int numLinha = 0;
+    int incluidos = 0, cancelados = 0, estoquesAlterados = 0;
+
+    while (std::getline(file, line)) {
+        numLinha++;
+        std::istringstream ss(line);
+        char operacao;
+        if (!(ss >> operacao) || operacao == '#') {
+            continue;
+        }
+
+        if (operacao == '+') {
+            int numItensPedido;
+            if (!(ss >> numItensPedido) || numItensPedido <= 0) {
+                throw std::runtime_error("Alteração inválida na linha " + std::to_string(numLinha) +
+                                         ": número de itens do pedido ausente");
+            }
+            std::map<int, int> pedido;
+            for (int j = 0; j < numItensPedido; j++) {
+                int itemId, quantidade;
+                if (!(ss >> itemId >> quantidade) || itemId < 0 || itemId >= deposito.numItens || quantidade <= 0) {
+                    throw std::runtime_error("Alteração inválida na linha " + std::to_string(numLinha) +
+                                             ": item " + std::to_string(j) + " do pedido");
+                }
+                pedido[itemId] += quantidade;
+            }
+            backlog.pedido.push_back(std::move(pedido));
+            backlog.numPedidos++;
+            incluidos++;
+        } else if (operacao == '-') {
+            int pedidoId;
+            if (!(ss >> pedidoId) || pedidoId < 0 || pedidoId >= backlog.numPedidos) {
+                throw std::runtime_error("Alteração inválida na linha " + std::to_string(numLinha) +
+                                         ": ID de pedido inexistente");
+            }
+            backlog.pedido[pedidoId].clear();
+            cancelados++;
+        } else if (operacao == 'E') {
+            int corredorId, itemId, quantidade;
+            if (!(ss >> corredorId >> itemId >> quantidade) || corredorId < 0 || corredorId >= deposito.numCorredores ||
+                itemId < 0 || itemId >= deposito.numItens || quantidade < 0) {
+                throw std::runtime_error("Alteração inválida na linha " + std::to_string(numLinha) +
+                                         ": estoque de corredor");
+            }
+            if (quantidade > 0) {
+                deposito.corredor[corredorId][itemId] = quantidade;
+            } else {
+                deposito.corredor[corredorId].erase(itemId);
+            }
+            estoquesAlterados++;
+        } else {
+            throw std::runtime_error("Operação desconhecida na linha " + std::to_string(numLinha) +
+                                     ": " + std::string(1, operacao));
+        }
+    }
+
+    std::cout << "Alterações aplicadas: " << incluidos << " pedidos incluídos, " << cancelados
+              << " cancelados, " << estoquesAlterados << " estoques alterados\n";
+}
+
+Solucao mapearSolucao(const SolucaoValidacao& anterior, const Deposito& deposito, const Backlog& backlog) {
+    Solucao solucao;
+    for (int pedidoId : anterior.pedidosWave) {
+        if (pedidoId >= 0 && pedidoId < backlog.numPedidos && !backlog.pedido[pedidoId].empty() &&
+            !solucao.pedidosWave.contem(pedidoId)) {
+            solucao.pedidosWave.inserir(pedidoId);
+        }
+    }
+    for (int corredorId : anterior.corredoresWave) {
+        if (corredorId >= 0 && corredorId < deposito.numCorredores) {
+            solucao.corredoresWave.push_back(corredorId);
+        }
+    }
+    solucao.valorObjetivo = calcularValorObjetivo(deposito, backlog, solucao);
+    return solucao;
+}
+
+Solucao reotimizarSolucao(const InstanciaPtr& instancia, const Solucao& anterior, int maxIteracoes,
+                          const CallbackIncumbente& aoMelhorar) {
+    const Deposito& deposito = instancia->getDeposito();
+    const Backlog& backlog = instancia->getBacklog();
+    const LocalizadorItens& localizador = instancia->getLocalizador();
+    const VerificadorDisponibilidade& verificador = instancia->getVerificador();
+    const AnalisadorRelevancia& analisador = instancia->getAnalisador();
+
+    // A busca e os ajustes usam a parcela de threads da instância
+    ConfiguracaoSolver configuracao;
+    configuracao.maxIteracoes = maxIteracoes;
+    configuracao.numThreads = instancia->getNumThreads();
+
+    // Reparar a solução anterior (estoque, LB/UB e corredores) e continuar a busca a partir dela
+    Solucao reparada = ajustarSolucao(deposito, backlog, anterior, localizador, verificador, analisador,
+                                      configuracao.numThreads);
+    Solucao melhorAjustada = reparada;
+    if (aoMelhorar) {
+        aoMelhorar(melhorAjustada);
+    }
+
+    // Cada solução aceita pela busca é ajustada uma única vez, como em resolverWave
+    auto registrarCandidata = [&](const Solucao& candidata) {
+        Solucao ajustada = ajustarSolucao(deposito, backlog, candidata, localizador, verificador, analisador,
+                                          configuracao.numThreads);
+        if (ajustada.valorObjetivo > melhorAjustada.valorObjetivo) {
+            melhorAjustada = std::move(ajustada);
+            if (aoMelhorar) {
+                aoMelhorar(melhorAjustada);
+            }
+        }
+    };
+    otimizarSolucao(deposito, backlog, reparada, localizador, verificador, analisador,
+                    configuracao, registrarCandidata);
+
+    return melhorAjustada;
+}
+
+void processarPartidaQuente(const std::string& arquivoInstancia, const std::string& arquivoSolucao,
+                            const std::string& arquivoDelta, const std::string& diretorioSaida) {
+    auto inicio = std::chrono::steady_clock::now();
+
+    InstanciaPtr instancia;
+    if (arquivoDelta.empty()) {
+        instancia = Instancia::carregar(arquivoInstancia);
+    } else {
+        InputParser parser;
+        auto [deposito, backlog] = parser.parseFile(arquivoInstancia);
+        aplicarDelta(deposito, backlog, arquivoDelta);
+        instancia = Instancia::criar(std::move(deposito), std::move(backlog));
+    }
+
+    Solucao anterior = mapearSolucao(lerArquivoSolucao(arquivoSolucao),
+                                     instancia->getDeposito(), instancia->getBacklog());
+    Solucao solucaoFinal = reotimizarSolucao(instancia, anterior);
+
+    if (!std::filesystem::exists(diretorioSaida)) {
+        std::filesystem::create_directory(diretorioSaida);
+    }
+    std::string nomeArquivo = std::filesystem::path(arquivoInstancia).filename().string();
+    salvarSolucao(diretorioSaida, nomeArquivo, solucaoFinal);
+
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    std::cout << "Objetivo: " << anterior.valorObjetivo << " (solução anterior mapeada) -> "
+              << solucaoFinal.valorObjetivo << " em " << segundos << " s\n";
+}
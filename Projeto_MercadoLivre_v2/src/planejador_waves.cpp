@@ -0,0 +1,144 @@
+#include "planejador_waves.h"
+#include "oraculo_viabilidade.h"
+#include <iostream>
+#include <filesystem>
+
+PlanejadorWaves::PlanejadorWaves(const InstanciaPtr& instancia)
+    : deposito(instancia->getDeposito()),
+      backlog(instancia->getBacklog()),
+      localizador(deposito.numItens),
+      verificador(deposito.numItens),
+      analisador(backlog.numPedidos),
+      agrupador(backlog.numPedidos),
+      marcadorPedido(backlog.numPedidos, -1),
+      numPedidosAtivos(backlog.numPedidos) {
+    localizador.construir(deposito);
+    verificador.construir(deposito);
+    verificador.indexarPedidos(backlog);
+    analisador.construir(backlog, localizador);
+    agrupador.construir(backlog, localizador);
+
+    // Índice item -> pedidos em CSR (contagem, prefixo, preenchimento)
+    inicioItemPedidos.assign(deposito.numItens + 1, 0);
+    for (const auto& pedido : backlog.pedido) {
+        for (const auto& [itemId, quantidade] : pedido) {
+            inicioItemPedidos[itemId + 1]++;
+        }
+    }
+    for (int itemId = 0; itemId < deposito.numItens; itemId++) {
+        inicioItemPedidos[itemId + 1] += inicioItemPedidos[itemId];
+    }
+    pedidosDoItem.resize(inicioItemPedidos[deposito.numItens]);
+    std::vector<int> proximo(inicioItemPedidos.begin(), inicioItemPedidos.end() - 1);
+    for (int pedidoId = 0; pedidoId < backlog.numPedidos; pedidoId++) {
+        for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
+            pedidosDoItem[proximo[itemId]++] = pedidoId;
+        }
+    }
+}
+
+bool PlanejadorWaves::waveViavel(const Solucao& wave) const {
+    if (wave.pedidosWave.empty() || wave.corredoresWave.empty()) {
+        return false;
+    }
+
+    int totalUnidades = 0;
+    for (int pedidoId : wave.pedidosWave) {
+        if (!analisador.ativo[pedidoId]) return false;
+        totalUnidades += analisador.numUnidades[pedidoId];
+    }
+    if (totalUnidades < backlog.wave.LB || totalUnidades > backlog.wave.UB) {
+        return false;
+    }
+
+    OraculoViabilidade oraculo(deposito, backlog);
+    for (int pedidoId : wave.pedidosWave) {
+        oraculo.adicionarPedido(pedidoId);
+    }
+    for (int corredorId : wave.corredoresWave) {
+        oraculo.abrirCorredor(corredorId);
+    }
+    return oraculo.viavel();
+}
+
+void PlanejadorWaves::consumirWave(const Solucao& wave) {
+    OraculoViabilidade oraculo(deposito, backlog);
+    for (int pedidoId : wave.pedidosWave) {
+        oraculo.adicionarPedido(pedidoId);
+    }
+    for (int corredorId : wave.corredoresWave) {
+        oraculo.abrirCorredor(corredorId);
+    }
+
+    // Descontar o estoque retirado de cada corredor
+    std::vector<int> itensAlterados;
+    for (const auto& atribuicao : oraculo.atribuirEstoque(localizador)) {
+        auto& estoqueCorredor = deposito.corredor[atribuicao.corredorId];
+        auto it = estoqueCorredor.find(atribuicao.itemId);
+        int novaQuantidade = it->second - atribuicao.quantidade;
+        if (novaQuantidade > 0) {
+            it->second = novaQuantidade;
+        } else {
+            estoqueCorredor.erase(it);
+        }
+        localizador.atualizarEstoque(atribuicao.corredorId, atribuicao.itemId, novaQuantidade);
+        verificador.consumirEstoque(atribuicao.itemId, atribuicao.quantidade);
+        itensAlterados.push_back(atribuicao.itemId);
+    }
+
+    // Retirar os pedidos atendidos
+    for (int pedidoId : wave.pedidosWave) {
+        verificador.removerPedido(pedidoId);
+        analisador.removerPedido(pedidoId);
+        numPedidosAtivos--;
+    }
+
+    // Reavaliar apenas os pedidos ativos que usam algum item alterado
+    std::vector<int> pedidosAfetados;
+    for (int itemId : itensAlterados) {
+        for (int k = inicioItemPedidos[itemId]; k < inicioItemPedidos[itemId + 1]; k++) {
+            int pedidoId = pedidosDoItem[k];
+            if (analisador.ativo[pedidoId] && marcadorPedido[pedidoId] != numWaves) {
+                marcadorPedido[pedidoId] = numWaves;
+                pedidosAfetados.push_back(pedidoId);
+            }
+        }
+    }
+    verificador.reverificarPedidos(pedidosAfetados);
+    analisador.reavaliarPedidos(backlog, localizador, pedidosAfetados);
+}
+
+bool PlanejadorWaves::proximaWave(Solucao& wave) {
+    if (numPedidosAtivos == 0) {
+        return false;
+    }
+
+    wave = resolverWave(deposito, backlog, localizador, verificador, analisador, agrupador);
+    if (!waveViavel(wave)) {
+        return false;
+    }
+
+    consumirWave(wave);
+    numWaves++;
+    return true;
+}
+
+int PlanejadorWaves::planejar(const std::string& diretorioSaida, const std::string& nomeArquivo, int maxWaves) {
+    if (!std::filesystem::exists(diretorioSaida)) {
+        std::filesystem::create_directory(diretorioSaida);
+    }
+
+    std::string nomeBase = nomeArquivo.substr(0, nomeArquivo.find_last_of("."));
+    int wavesGeradas = 0;
+    Solucao wave;
+
+    while ((maxWaves <= 0 || wavesGeradas < maxWaves) && proximaWave(wave)) {
+        wavesGeradas++;
+        std::cout << "Wave " << wavesGeradas << ": " << wave.pedidosWave.size() << " pedidos, "
+                  << wave.corredoresWave.size() << " corredores, objetivo " << wave.valorObjetivo
+                  << " (" << numPedidosAtivos << " pedidos restantes)\n";
+        salvarSolucao(diretorioSaida, nomeBase + "_wave" + std::to_string(wavesGeradas) + ".sol", wave);
+    }
+
+    return wavesGeradas;
+}
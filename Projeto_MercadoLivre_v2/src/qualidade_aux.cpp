@@ -0,0 +1,130 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "avaliacao_qualidade.h"
+
+// Avaliação de qualidade x tempo sobre um diretório de instâncias, com comparação opcional
+// a uma linha de base (código de saída 1 se houver regressão).
+
+namespace {
+
+template <typename T>
+std::vector<T> lerLista(const std::string& texto) {
+    std::vector<T> valores;
+    std::stringstream ss(texto);
+    std::string campo;
+    while (std::getline(ss, campo, ',')) {
+        std::istringstream conversor(campo);
+        T valor;
+        if (!(conversor >> valor)) {
+            throw std::invalid_argument("lista inválida: " + texto);
+        }
+        valores.push_back(valor);
+    }
+    return valores;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string diretorioEntrada = "data/input";
+    std::string diretorioSaida = "data/qualidade";
+    std::string arquivoBase;
+    bool atualizarBase = false;
+    std::vector<unsigned int> listaThreads = {1};
+    std::vector<double> temposCorte = {1.0, 10.0, 60.0};
+    ConfiguracaoSolver configuracao;
+    configuracao.semente = 42;
+    ToleranciasQualidade tolerancias;
+
+    try {
+        for (int i = 1; i < argc; i++) {
+            std::string opcao = argv[i];
+            if (opcao == "--atualizar-base") {
+                atualizarBase = true;
+                continue;
+            }
+            if (opcao == "--deterministico") {
+                configuracao.deterministico = true;
+                continue;
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("valor ausente para " + opcao);
+            }
+            std::string valor = argv[++i];
+            if (opcao == "--entrada") diretorioEntrada = valor;
+            else if (opcao == "--saida") diretorioSaida = valor;
+            else if (opcao == "--base") arquivoBase = valor;
+            else if (opcao == "--threads") listaThreads = lerLista<unsigned int>(valor);
+            else if (opcao == "--tempos") temposCorte = lerLista<double>(valor);
+            else if (opcao == "--iteracoes") configuracao.maxIteracoes = std::stoi(valor);
+            else if (opcao == "--semente") configuracao.semente = std::stoull(valor);
+            else if (opcao == "--tol-objetivo") tolerancias.objetivo = std::stod(valor);
+            else if (opcao == "--tol-tempo") tolerancias.tempo = std::stod(valor);
+            else if (opcao == "--tol-memoria") tolerancias.memoria = std::stod(valor);
+            else throw std::invalid_argument("opção desconhecida: " + opcao);
+        }
+        if (temposCorte.empty() || listaThreads.empty()) {
+            throw std::invalid_argument("--tempos e --threads não podem ser vazios");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Argumento inválido (" << e.what() << ")\n"
+                  << "Uso: " << argv[0] << " [--entrada dir] [--saida dir] [--threads 1,4] [--tempos 1,10,60]\n"
+                  << "       [--iteracoes n] [--semente n] [--deterministico] [--base arquivo.csv] [--atualizar-base]\n"
+                  << "       [--tol-objetivo 0.02] [--tol-tempo fator] [--tol-memoria fator]\n";
+        return 2;
+    }
+    std::sort(temposCorte.begin(), temposCorte.end());
+    configuracao.tempoLimite = temposCorte.back();
+
+    std::vector<std::filesystem::path> arquivos;
+    for (const auto& entry : std::filesystem::directory_iterator(diretorioEntrada)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".txt") {
+            arquivos.push_back(entry.path());
+        }
+    }
+    std::sort(arquivos.begin(), arquivos.end());
+
+    // Instâncias em sequência: o pico de memória e o tempo de cada uma não se misturam
+    std::vector<ResultadoQualidade> resultados;
+    for (unsigned int numThreads : listaThreads) {
+        configuracao.numThreads = numThreads;
+        for (const auto& arquivo : arquivos) {
+            resultados.push_back(avaliarInstancia(arquivo.string(), configuracao, temposCorte));
+            const ResultadoQualidade& r = resultados.back();
+            std::cout << "QUALIDADE instancia=" << r.instancia << " threads=" << numThreads
+                      << " objetivo=" << r.objetivoFinal << " gap=" << r.gap << " tempo=" << r.tempoTotal
+                      << " memoria_kb=" << r.memoriaPicoKB << (r.valida ? "" : " INVALIDA") << std::endl;
+        }
+    }
+
+    std::filesystem::create_directories(diretorioSaida);
+    std::ofstream csv(diretorioSaida + "/qualidade.csv");
+    escreverQualidadeCsv(resultados, temposCorte, csv);
+    std::ofstream json(diretorioSaida + "/qualidade.json");
+    escreverQualidadeJson(resultados, temposCorte, json);
+    std::cout << "Resultados salvos em " << diretorioSaida << "/qualidade.{csv,json}\n";
+
+    if (arquivoBase.empty()) {
+        return 0;
+    }
+    if (atualizarBase) {
+        std::ofstream base(arquivoBase);
+        escreverQualidadeCsv(resultados, temposCorte, base);
+        std::cout << "Linha de base atualizada: " << arquivoBase << "\n";
+        return 0;
+    }
+
+    try {
+        int regressoes = compararComBase(resultados, arquivoBase, tolerancias, std::cerr);
+        std::cout << "Comparação com " << arquivoBase << ": " << regressoes << " regressão(ões)\n";
+        return regressoes == 0 ? 0 : 1;
+    } catch (const std::exception& e) {
+        std::cerr << "Erro: " << e.what() << "\n";
+        return 1;
+    }
+}
@@ -0,0 +1,161 @@
+#include "rastreamento.h"
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+std::atomic<bool> RastreadorEventos::ligado{false};
+
+namespace {
+
+struct EventoRastreado {
+    const char* nome;
+    const char* detalhe;
+    uint64_t inicioNs;
+    uint64_t duracaoNs;
+    double valor;
+    uint32_t thread;
+    char tipo; // 'X' intervalo, 'i' instante
+};
+
+// Buffer circular de uma thread por vez: só o dono escreve; a leitura ocorre em finalizar()
+struct BufferRastreamento {
+    explicit BufferRastreamento(size_t capacidade) : eventos(capacidade) {}
+    std::vector<EventoRastreado> eventos;
+    std::atomic<uint64_t> escritos{0};
+};
+
+std::mutex mutexRastreamento;
+std::vector<std::unique_ptr<BufferRastreamento>> buffers;
+std::vector<BufferRastreamento*> buffersLivres;
+std::deque<std::string> textosInternados;
+size_t capacidadeBuffer = 1 << 16;
+uint64_t geracao = 0;
+std::atomic<uint32_t> proximaThread{1};
+std::chrono::steady_clock::time_point inicioRastreamento = std::chrono::steady_clock::now();
+
+// Posse do buffer pela thread corrente; devolve ao pool quando a thread termina
+struct PosseBuffer {
+    BufferRastreamento* buffer = nullptr;
+    uint64_t geracao = 0;
+    uint32_t thread = 0;
+
+    ~PosseBuffer() {
+        if (!buffer) return;
+        std::lock_guard<std::mutex> lock(mutexRastreamento);
+        if (geracao == ::geracao) buffersLivres.push_back(buffer);
+    }
+};
+
+thread_local PosseBuffer posse;
+
+BufferRastreamento* bufferDaThread() {
+    if (posse.buffer && posse.geracao == geracao) {
+        return posse.buffer;
+    }
+    std::lock_guard<std::mutex> lock(mutexRastreamento);
+    if (buffersLivres.empty()) {
+        buffers.push_back(std::make_unique<BufferRastreamento>(capacidadeBuffer));
+        buffersLivres.push_back(buffers.back().get());
+    }
+    posse.buffer = buffersLivres.back();
+    buffersLivres.pop_back();
+    posse.geracao = geracao;
+    posse.thread = proximaThread.fetch_add(1, std::memory_order_relaxed);
+    return posse.buffer;
+}
+
+void gravar(const EventoRastreado& evento) {
+    BufferRastreamento* buffer = bufferDaThread();
+    uint64_t posicao = buffer->escritos.load(std::memory_order_relaxed);
+    buffer->eventos[posicao % buffer->eventos.size()] = evento;
+    buffer->eventos[posicao % buffer->eventos.size()].thread = posse.thread;
+    buffer->escritos.store(posicao + 1, std::memory_order_release);
+}
+
+void escreverTexto(std::ostream& saida, const char* texto) {
+    saida << '"';
+    for (const char* c = texto; *c; c++) {
+        if (*c == '"' || *c == '\\') saida << '\\';
+        if (static_cast<unsigned char>(*c) >= 0x20) saida << *c;
+    }
+    saida << '"';
+}
+
+} // namespace
+
+void RastreadorEventos::iniciar(size_t eventosPorThread) {
+    std::lock_guard<std::mutex> lock(mutexRastreamento);
+    // Buffers de gerações anteriores são descartados; threads que ainda os possuem pegam novos
+    buffers.clear();
+    buffersLivres.clear();
+    textosInternados.clear();
+    capacidadeBuffer = eventosPorThread > 0 ? eventosPorThread : 1;
+    geracao++;
+    inicioRastreamento = std::chrono::steady_clock::now();
+    ligado.store(true, std::memory_order_release);
+}
+
+uint64_t RastreadorEventos::agoraNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - inicioRastreamento).count());
+}
+
+void RastreadorEventos::registrarIntervalo(const char* nome, uint64_t inicioNs, const char* detalhe) {
+    if (!ativo()) return;
+    uint64_t fimNs = agoraNs();
+    gravar({nome, detalhe, inicioNs, fimNs - inicioNs, 0.0, 0, 'X'});
+}
+
+void RastreadorEventos::registrarInstante(const char* nome, double valor) {
+    if (!ativo()) return;
+    gravar({nome, nullptr, agoraNs(), 0, valor, 0, 'i'});
+}
+
+const char* RastreadorEventos::internar(const std::string& texto) {
+    std::lock_guard<std::mutex> lock(mutexRastreamento);
+    textosInternados.push_back(texto);
+    return textosInternados.back().c_str();
+}
+
+bool RastreadorEventos::finalizar(const std::string& arquivo) {
+    ligado.store(false, std::memory_order_release);
+
+    std::ofstream saida(arquivo);
+    if (!saida.is_open()) {
+        return false;
+    }
+    saida << std::fixed << std::setprecision(3);
+    saida << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [";
+
+    std::lock_guard<std::mutex> lock(mutexRastreamento);
+    bool primeiro = true;
+    for (const auto& buffer : buffers) {
+        uint64_t escritos = buffer->escritos.load(std::memory_order_acquire);
+        uint64_t capacidade = buffer->eventos.size();
+        for (uint64_t i = escritos > capacidade ? escritos - capacidade : 0; i < escritos; i++) {
+            const EventoRastreado& evento = buffer->eventos[i % capacidade];
+            saida << (primeiro ? "\n" : ",\n") << "{\"name\": ";
+            escreverTexto(saida, evento.nome);
+            saida << ", \"ph\": \"" << evento.tipo << "\", \"pid\": 1, \"tid\": " << evento.thread
+                  << ", \"ts\": " << evento.inicioNs / 1000.0;
+            if (evento.tipo == 'X') {
+                saida << ", \"dur\": " << evento.duracaoNs / 1000.0;
+                if (evento.detalhe) {
+                    saida << ", \"args\": {\"detalhe\": ";
+                    escreverTexto(saida, evento.detalhe);
+                    saida << "}";
+                }
+            } else {
+                saida << ", \"s\": \"t\", \"args\": {\"valor\": " << evento.valor << "}";
+            }
+            saida << "}";
+            primeiro = false;
+        }
+    }
+    saida << "\n]}\n";
+    return static_cast<bool>(saida);
+}
@@ -0,0 +1,123 @@
+#include "seletor_corredores.h"
+#include "instrumentacao.h"
+#include <algorithm>
+#include <utility>
+
+SeletorCorredores::SeletorCorredores(const LocalizadorItens& localizador)
+    : localizador(localizador),
+      demandaRestante(localizador.inicioItem.size() - 1, 0),
+      demandaTotal(localizador.inicioItem.size() - 1, 0),
+      oferta(localizador.inicioItem.size() - 1, 0),
+      corredorVisto((localizador.numCorredores + 63) / 64, 0) {}
+
+long long SeletorCorredores::calcularCobertura(int corredorId) const {
+    long long cobertura = 0;
+    for (int k = localizador.inicioCorredor[corredorId]; k < localizador.inicioCorredor[corredorId + 1]; k++) {
+        cobertura += std::min(localizador.quantidadeDoCorredor[k], demandaRestante[localizador.itemDoCorredor[k]]);
+    }
+    return cobertura;
+}
+
+void SeletorCorredores::selecionar(const Backlog& backlog, const std::vector<int>& pedidos,
+                                   std::vector<int>& escolhidos) {
+    INSTRUMENTAR_CONTADOR(CONTADOR_RECONSTRUCOES_CORREDORES, 1);
+    // 1. Demanda agregada por item
+    long long totalRestante = 0;
+    itensDemandados.clear();
+    for (int pedidoId : pedidos) {
+        for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
+            if (demandaTotal[itemId] == 0) itensDemandados.push_back(itemId);
+            demandaTotal[itemId] += quantidade;
+            demandaRestante[itemId] += quantidade;
+            totalRestante += quantidade;
+        }
+    }
+    
+    // 2. Corredores candidatos: os que possuem algum item demandado
+    candidatos.clear();
+    for (int itemId : itensDemandados) {
+        for (int k = localizador.inicioItem[itemId]; 
+             k < localizador.inicioItem[itemId + 1] && localizador.quantidadeOrdenada[k] > 0; k++) {
+            int corredorId = localizador.corredorOrdenado[k];
+            uint64_t mascara = 1ULL << (corredorId & 63);
+            if (!(corredorVisto[corredorId >> 6] & mascara)) {
+                corredorVisto[corredorId >> 6] |= mascara;
+                candidatos.push_back(corredorId);
+            }
+        }
+    }
+    
+    // 3. Guloso preguiçoso: a cobertura só diminui, então a chave na fila é um limite superior
+    fila.clear();
+    for (int corredorId : candidatos) {
+        fila.emplace_back(calcularCobertura(corredorId), -corredorId);
+    }
+    std::make_heap(fila.begin(), fila.end());
+    
+    escolhidos.clear();
+    while (totalRestante > 0 && !fila.empty()) {
+        std::pop_heap(fila.begin(), fila.end());
+        auto [coberturaAntiga, chaveCorredor] = fila.back();
+        fila.pop_back();
+        int corredorId = -chaveCorredor;
+        
+        long long cobertura = calcularCobertura(corredorId);
+        if (cobertura <= 0) continue;
+        if (cobertura < coberturaAntiga && !fila.empty() && cobertura < fila.front().first) {
+            fila.emplace_back(cobertura, chaveCorredor);
+            std::push_heap(fila.begin(), fila.end());
+            continue;
+        }
+        
+        escolhidos.push_back(corredorId);
+        for (int k = localizador.inicioCorredor[corredorId]; k < localizador.inicioCorredor[corredorId + 1]; k++) {
+            int itemId = localizador.itemDoCorredor[k];
+            int atendido = std::min(localizador.quantidadeDoCorredor[k], demandaRestante[itemId]);
+            demandaRestante[itemId] -= atendido;
+            totalRestante -= atendido;
+            if (demandaTotal[itemId] > 0) oferta[itemId] += localizador.quantidadeDoCorredor[k];
+        }
+    }
+    
+    // 4. Eliminar corredores redundantes, começando pelos últimos escolhidos (menor cobertura)
+    if (totalRestante == 0) {
+        mantido.assign(escolhidos.size(), 1);
+        for (int idx = static_cast<int>(escolhidos.size()) - 1; idx >= 0; idx--) {
+            int corredorId = escolhidos[idx];
+            bool redundante = true;
+            for (int k = localizador.inicioCorredor[corredorId]; 
+                 k < localizador.inicioCorredor[corredorId + 1] && redundante; k++) {
+                int itemId = localizador.itemDoCorredor[k];
+                redundante = demandaTotal[itemId] == 0 ||
+                             oferta[itemId] - localizador.quantidadeDoCorredor[k] >= demandaTotal[itemId];
+            }
+            if (redundante) {
+                mantido[idx] = 0;
+                for (int k = localizador.inicioCorredor[corredorId]; k < localizador.inicioCorredor[corredorId + 1]; k++) {
+                    int itemId = localizador.itemDoCorredor[k];
+                    if (demandaTotal[itemId] > 0) oferta[itemId] -= localizador.quantidadeDoCorredor[k];
+                }
+            }
+        }
+        
+        size_t proximo = 0;
+        for (size_t idx = 0; idx < escolhidos.size(); idx++) {
+            if (mantido[idx]) escolhidos[proximo++] = escolhidos[idx];
+        }
+        escolhidos.resize(proximo);
+    } else {
+        escolhidos.clear();
+    }
+    
+    // 5. Limpar apenas as posições tocadas nos buffers
+    for (int itemId : itensDemandados) {
+        demandaTotal[itemId] = 0;
+        demandaRestante[itemId] = 0;
+        oferta[itemId] = 0;
+    }
+    for (int corredorId : candidatos) {
+        corredorVisto[corredorId >> 6] = 0;
+    }
+    
+    std::sort(escolhidos.begin(), escolhidos.end());
+}
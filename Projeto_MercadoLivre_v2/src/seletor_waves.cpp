@@ -1,62 +1,150 @@
 #include "seletor_waves.h"
+#include <algorithm>
+#include <thread>
+
+namespace {
+
+/**
+ * @brief Melhor janela [inicio, fim) encontrada por uma thread
+ */
+struct MelhorJanela {
+    int inicio = 0;
+    int fim = 0;
+    int unidades = 0;
+    int numCorredores = 0;
+    double razao = -1.0;
+};
+
+// Tamanho mínimo do bloco de inícios processado por thread
+constexpr int TAMANHO_MINIMO_BLOCO = 1024;
+
+} // namespace
 
 SeletorWaves::WaveCandidata SeletorWaves::selecionarWaveOtima(
     const Backlog& backlog,
     const std::vector<int>& pedidosOrdenados,
     const AnalisadorRelevancia& analisador,
-    const LocalizadorItens& localizador) {
+    const LocalizadorItens& localizador,
+    unsigned int numThreads) {
     
-    WaveCandidata melhorWave;
-    melhorWave.totalUnidades = 0;
+    const int n = static_cast<int>(pedidosOrdenados.size());
+    
+    // Pré-calcular unidades e corredores de cada posição da lista ordenada
+    std::vector<int> unidades(n);
+    std::vector<std::vector<int>> corredoresPosicao(n);
+    int numCorredores = 0;
+    for (int i = 0; i < n; i++) {
+        int pedidoId = pedidosOrdenados[i];
+        unidades[i] = analisador.numUnidades[pedidoId];
+        corredoresPosicao[i] = localizador.getCorredoresPedido(backlog.pedido[pedidoId]);
+        if (!corredoresPosicao[i].empty()) {
+            numCorredores = std::max(numCorredores, corredoresPosicao[i].back() + 1);
+        }
+    }
+    
+    // Fim da janela de cada início na varredura sequencial (depende só das unidades): permite
+    // que cada bloco retome a varredura exatamente onde a versão sequencial estaria
+    std::vector<int> fimAposInicio(n);
+    {
+        int fim = 0;
+        int totalUnidades = 0;
+        for (int inicio = 0; inicio < n; inicio++) {
+            if (fim < inicio) fim = inicio;
+            while (fim < n && totalUnidades + unidades[fim] <= backlog.wave.UB) {
+                totalUnidades += unidades[fim++];
+            }
+            fimAposInicio[inicio] = fim;
+            if (fim > inicio) totalUnidades -= unidades[inicio];
+        }
+    }
     
-    WaveCandidata waveAtual;
-    waveAtual.totalUnidades = 0;
-    
-    for (int pedidoId : pedidosOrdenados) {
-        // Verificar se adicionar este pedido excederia o limite superior (UB)
-        int unidadesPedido = analisador.infoPedidos[pedidoId].numUnidades;
-        if (waveAtual.totalUnidades + unidadesPedido > backlog.wave.UB) {
-            // Se já atingimos o limite inferior (LB), esta wave é válida
-            if (waveAtual.totalUnidades >= backlog.wave.LB) {
-                // Se for melhor que a melhor wave encontrada até agora
-                if (melhorWave.totalUnidades == 0 || 
-                    waveAtual.corredoresNecessarios.size() < melhorWave.corredoresNecessarios.size()) {
-                    melhorWave = waveAtual;
+    // Varre os inícios [inicioBloco, fimBloco) com dois ponteiros
+    auto varrerBloco = [&](int inicioBloco, int fimBloco, MelhorJanela& melhor) {
+        std::vector<int> contagem(numCorredores, 0);
+        int corredoresAtivos = 0;
+        int totalUnidades = 0;
+        int fim = inicioBloco;
+        
+        // Reconstruir, sem avaliá-la, a janela herdada do início anterior ao bloco
+        if (inicioBloco > 0) {
+            for (; fim < fimAposInicio[inicioBloco - 1]; fim++) {
+                totalUnidades += unidades[fim];
+                for (int corredorId : corredoresPosicao[fim]) {
+                    if (contagem[corredorId]++ == 0) corredoresAtivos++;
                 }
             }
-            continue;
         }
         
-        // Adicionar pedido à wave atual
-        waveAtual.pedidosIds.push_back(pedidoId);
-        waveAtual.totalUnidades += unidadesPedido;
+        auto avaliar = [&](int inicio) {
+            if (totalUnidades < backlog.wave.LB || corredoresAtivos == 0) return;
+            double razao = static_cast<double>(totalUnidades) / corredoresAtivos;
+            if (razao > melhor.razao) {
+                melhor = {inicio, fim, totalUnidades, corredoresAtivos, razao};
+            }
+        };
         
-        // Atualizar corredores necessários
-        for (const auto& [itemId, quantidadeSolicitada] : backlog.pedido[pedidoId]) {
-            int quantidadeRestante = quantidadeSolicitada;
-            const auto& corredoresComItem = localizador.getCorredoresComItem(itemId);
+        for (int inicio = inicioBloco; inicio < fimBloco; inicio++) {
+            if (fim < inicio) fim = inicio;
             
-            std::vector<std::pair<int, int>> corredoresOrdenados(
-                corredoresComItem.begin(), corredoresComItem.end());
-            std::sort(corredoresOrdenados.begin(), corredoresOrdenados.end(),
-                [](const auto& a, const auto& b) { return a.second > b.second; });
+            // Estender a janela enquanto o limite superior permitir
+            while (fim < n && totalUnidades + unidades[fim] <= backlog.wave.UB) {
+                totalUnidades += unidades[fim];
+                for (int corredorId : corredoresPosicao[fim]) {
+                    if (contagem[corredorId]++ == 0) corredoresAtivos++;
+                }
+                fim++;
+                avaliar(inicio);
+            }
+            avaliar(inicio);
             
-            for (const auto& [corredorId, quantidadeDisponivel] : corredoresOrdenados) {
-                if (quantidadeRestante <= 0) break;
-                
-                waveAtual.corredoresNecessarios.insert(corredorId);
-                quantidadeRestante -= std::min(quantidadeRestante, quantidadeDisponivel);
+            // Retirar o primeiro pedido da janela antes de avançar o início
+            if (fim > inicio) {
+                totalUnidades -= unidades[inicio];
+                for (int corredorId : corredoresPosicao[inicio]) {
+                    if (--contagem[corredorId] == 0) corredoresAtivos--;
+                }
             }
         }
-        
-        // Se a wave atual já é válida e melhor que a melhor encontrada
-        if (waveAtual.totalUnidades >= backlog.wave.LB) {
-            if (melhorWave.totalUnidades == 0 || 
-                waveAtual.corredoresNecessarios.size() < melhorWave.corredoresNecessarios.size()) {
-                melhorWave = waveAtual;
-            }
+    };
+    
+    if (numThreads == 0) numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 4;
+    numThreads = std::max(1u, std::min(numThreads, 
+        static_cast<unsigned int>((n + TAMANHO_MINIMO_BLOCO - 1) / TAMANHO_MINIMO_BLOCO)));
+    
+    std::vector<MelhorJanela> melhores(numThreads);
+    if (numThreads == 1) {
+        varrerBloco(0, n, melhores[0]);
+    } else {
+        std::vector<std::thread> threads;
+        int tamanhoBloco = (n + numThreads - 1) / numThreads;
+        for (unsigned int t = 0; t < numThreads; t++) {
+            int inicioBloco = std::min(n, static_cast<int>(t) * tamanhoBloco);
+            int fimBloco = std::min(n, inicioBloco + tamanhoBloco);
+            threads.emplace_back(varrerBloco, inicioBloco, fimBloco, std::ref(melhores[t]));
         }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    
+    // Escolher a melhor janela entre todas as threads (em ordem fixa)
+    MelhorJanela melhor;
+    for (const auto& candidata : melhores) {
+        if (candidata.razao > melhor.razao) melhor = candidata;
+    }
+    
+    WaveCandidata melhorWave;
+    melhorWave.totalUnidades = 0;
+    if (melhor.razao < 0) {
+        return melhorWave;
+    }
+    
+    melhorWave.totalUnidades = melhor.unidades;
+    for (int i = melhor.inicio; i < melhor.fim; i++) {
+        melhorWave.pedidosIds.push_back(pedidosOrdenados[i]);
+        melhorWave.corredoresNecessarios.insert(corredoresPosicao[i].begin(), corredoresPosicao[i].end());
     }
     
     return melhorWave;
-}
\ No newline at end of file
+}
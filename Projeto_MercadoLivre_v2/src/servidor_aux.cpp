@@ -0,0 +1,21 @@
+#include <iostream>
+#include <string>
+#include <csignal>
+#include "servidor_solver.h"
+
+int main(int argc, char* argv[]) {
+    std::string caminhoSocket = argc > 1 ? argv[1] : "/tmp/mercadolivre_solver.sock";
+    
+    // Clientes que desconectam no meio de uma resposta não devem derrubar o servidor
+    std::signal(SIGPIPE, SIG_IGN);
+    
+    try {
+        ServidorSolver servidor(caminhoSocket);
+        servidor.executar();
+    } catch (const std::exception& e) {
+        std::cerr << "Erro no servidor: " << e.what() << "\n";
+        return 1;
+    }
+    
+    return 0;
+}
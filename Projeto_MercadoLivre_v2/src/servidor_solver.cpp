@@ -0,0 +1,220 @@
+#include "servidor_solver.h"
+#include "partida_quente.h"
+#include "validar_resultados.h"
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace {
+
+// Limite de tamanho de um quadro (protege contra tamanhos corrompidos)
+constexpr uint32_t TAMANHO_MAXIMO_QUADRO = 64u << 20;
+
+bool escreverTudo(int fd, const char* dados, size_t tamanho) {
+    while (tamanho > 0) {
+        ssize_t escritos = send(fd, dados, tamanho, MSG_NOSIGNAL);
+        if (escritos <= 0) return false;
+        dados += escritos;
+        tamanho -= static_cast<size_t>(escritos);
+    }
+    return true;
+}
+
+bool lerTudo(int fd, char* dados, size_t tamanho) {
+    while (tamanho > 0) {
+        ssize_t lidos = recv(fd, dados, tamanho, 0);
+        if (lidos <= 0) return false;
+        dados += lidos;
+        tamanho -= static_cast<size_t>(lidos);
+    }
+    return true;
+}
+
+} // namespace
+
+bool enviarQuadro(int fd, const std::string& conteudo) {
+    uint32_t tamanho = static_cast<uint32_t>(conteudo.size());
+    unsigned char cabecalho[4] = {
+        static_cast<unsigned char>(tamanho >> 24), static_cast<unsigned char>(tamanho >> 16),
+        static_cast<unsigned char>(tamanho >> 8), static_cast<unsigned char>(tamanho)
+    };
+    return escreverTudo(fd, reinterpret_cast<const char*>(cabecalho), 4) &&
+           escreverTudo(fd, conteudo.data(), conteudo.size());
+}
+
+bool receberQuadro(int fd, std::string& conteudo) {
+    unsigned char cabecalho[4];
+    if (!lerTudo(fd, reinterpret_cast<char*>(cabecalho), 4)) return false;
+    uint32_t tamanho = (static_cast<uint32_t>(cabecalho[0]) << 24) | (static_cast<uint32_t>(cabecalho[1]) << 16) |
+                       (static_cast<uint32_t>(cabecalho[2]) << 8) | static_cast<uint32_t>(cabecalho[3]);
+    if (tamanho > TAMANHO_MAXIMO_QUADRO) return false;
+    conteudo.resize(tamanho);
+    return lerTudo(fd, conteudo.data(), tamanho);
+}
+
+ServidorSolver::ServidorSolver(std::string caminho) : caminhoSocket(std::move(caminho)) {}
+
+void ServidorSolver::executar() {
+    fdServidor = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fdServidor < 0) {
+        throw std::runtime_error("Não foi possível criar o socket: " + std::string(std::strerror(errno)));
+    }
+
+    sockaddr_un endereco{};
+    endereco.sun_family = AF_UNIX;
+    if (caminhoSocket.size() >= sizeof(endereco.sun_path)) {
+        throw std::runtime_error("Caminho do socket muito longo: " + caminhoSocket);
+    }
+    std::strncpy(endereco.sun_path, caminhoSocket.c_str(), sizeof(endereco.sun_path) - 1);
+    unlink(caminhoSocket.c_str());
+
+    if (bind(fdServidor, reinterpret_cast<sockaddr*>(&endereco), sizeof(endereco)) < 0 ||
+        listen(fdServidor, 16) < 0) {
+        close(fdServidor);
+        throw std::runtime_error("Não foi possível escutar em " + caminhoSocket + ": " + std::strerror(errno));
+    }
+    std::cout << "Servidor escutando em " << caminhoSocket << std::endl;
+
+    struct Conexao {
+        std::thread thread;
+        std::shared_ptr<std::atomic<bool>> encerrada;
+    };
+    std::vector<Conexao> conexoes;
+    while (ativo.load()) {
+        int fdCliente = accept(fdServidor, nullptr, nullptr);
+        if (fdCliente < 0) {
+            if (!ativo.load()) break;
+            if (errno == EINTR) continue;
+            std::cerr << "Erro em accept: " << std::strerror(errno) << std::endl;
+            break;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutexConexoes);
+            fdsAbertos.insert(fdCliente);
+        }
+
+        // Recolher as threads de conexões já encerradas, para que não se acumulem
+        for (size_t i = 0; i < conexoes.size();) {
+            if (conexoes[i].encerrada->load()) {
+                conexoes[i].thread.join();
+                conexoes[i] = std::move(conexoes.back());
+                conexoes.pop_back();
+            } else {
+                i++;
+            }
+        }
+
+        auto encerrada = std::make_shared<std::atomic<bool>>(false);
+        std::thread thread([this, fdCliente, encerrada]() {
+            atenderConexao(fdCliente);
+            {
+                std::lock_guard<std::mutex> lock(mutexConexoes);
+                fdsAbertos.erase(fdCliente);
+                close(fdCliente);
+            }
+            encerrada->store(true);
+        });
+        conexoes.push_back({std::move(thread), std::move(encerrada)});
+    }
+
+    // Desbloquear conexões ociosas para que as threads terminem
+    {
+        std::lock_guard<std::mutex> lock(mutexConexoes);
+        for (int fd : fdsAbertos) {
+            shutdown(fd, SHUT_RDWR);
+        }
+    }
+    for (auto& conexao : conexoes) {
+        conexao.thread.join();
+    }
+    close(fdServidor);
+    unlink(caminhoSocket.c_str());
+}
+
+void ServidorSolver::atenderConexao(int fd) {
+    std::string requisicao;
+    while (receberQuadro(fd, requisicao)) {
+        std::istringstream corpo(requisicao);
+        std::string linha, comando, caminho;
+        std::getline(corpo, linha);
+        std::istringstream(linha) >> comando >> caminho;
+
+        try {
+            if (comando == "SOLVE") {
+                processarSolve(fd, caminho);
+            } else if (comando == "UPDATE") {
+                processarUpdate(fd, caminho, corpo);
+            } else if (comando == "VALIDATE") {
+                processarValidate(fd, caminho, corpo);
+            } else if (comando == "SHUTDOWN") {
+                enviarQuadro(fd, "OK");
+                ativo.store(false);
+                shutdown(fdServidor, SHUT_RDWR);
+                return;
+            } else {
+                enviarQuadro(fd, "ERRO comando desconhecido: " + comando);
+            }
+        } catch (const std::exception& e) {
+            enviarQuadro(fd, std::string("ERRO ") + e.what());
+        }
+    }
+}
+
+void ServidorSolver::processarSolve(int fd, const std::string& caminho) {
+    CacheInstancias::Entrada entrada = cache.obter(caminho);
+    const InstanciaPtr& instancia = entrada.instancia;
+    const Deposito& deposito = instancia->getDeposito();
+    const Backlog& backlog = instancia->getBacklog();
+    const LocalizadorItens& localizador = instancia->getLocalizador();
+    const VerificadorDisponibilidade& verificador = instancia->getVerificador();
+    const AnalisadorRelevancia& analisador = instancia->getAnalisador();
+
+    // O solver só repassa soluções já ajustadas, a cada melhoria do valor viável
+    auto aoMelhorar = [fd](const Solucao& incumbente) {
+        enviarQuadro(fd, "INCUMBENT " + std::to_string(incumbente.valorObjetivo) + "\n" + formatarSolucao(incumbente));
+    };
+
+    Solucao solucao;
+    if (entrada.ultimaSolucao) {
+        SolucaoValidacao anterior{entrada.ultimaSolucao->pedidosWave.ids(), entrada.ultimaSolucao->corredoresWave};
+        solucao = reotimizarSolucao(instancia, mapearSolucao(anterior, deposito, backlog), 25, aoMelhorar);
+    } else {
+        solucao = resolverWave(deposito, backlog, localizador, verificador, analisador,
+                               instancia->getAgrupador(), aoMelhorar);
+    }
+
+    cache.registrarSolucao(caminho, solucao);
+    enviarQuadro(fd, "RESULT " + std::to_string(solucao.valorObjetivo) + "\n" + formatarSolucao(solucao));
+}
+
+void ServidorSolver::processarUpdate(int fd, const std::string& caminho, std::istream& corpo) {
+    // Copiar, alterar e publicar numa única alteração do cache, para que UPDATEs simultâneos
+    // da mesma instância não descartem um ao outro
+    InstanciaPtr nova = cache.modificar(caminho, [&corpo](const Instancia& atual) {
+        Deposito deposito = atual.getDeposito();
+        Backlog backlog = atual.getBacklog();
+        aplicarDelta(deposito, backlog, corpo);
+        return Instancia::criar(std::move(deposito), std::move(backlog), atual.getNumThreads());
+    });
+    enviarQuadro(fd, "OK " + std::to_string(nova->getBacklog().numPedidos));
+}
+
+void ServidorSolver::processarValidate(int fd, const std::string& caminho, std::istream& corpo) {
+    CacheInstancias::Entrada entrada = cache.obter(caminho);
+    RelatorioValidacao relatorio = validarSolucao(*entrada.instancia, lerSolucao(corpo));
+    relatorio.instancia = caminho;
+
+    std::ostringstream texto;
+    escreverRelatorioTexto(relatorio, texto);
+    enviarQuadro(fd, std::string(relatorio.valida ? "VALIDO" : "INVALIDO") + "\n" + texto.str());
+}
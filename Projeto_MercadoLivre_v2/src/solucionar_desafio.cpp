@@ -1,10 +1,19 @@
 #include "solucionar_desafio.h"
-#include "parser.h"
+#include "instancia.h"
 #include "localizador_itens.h"
 #include "verificador_disponibilidade.h"
 #include "analisador_relevancia.h"
+#include "agrupador_pedidos.h"
 #include "gestor_waves.h" 
 #include "seletor_waves.h"
+#include "oraculo_viabilidade.h"
+#include "seletor_corredores.h"
+#include "fila_limitada.h"
+#include "cache_instancias.h"
+#include "instrumentacao.h"
+#include "rastreamento.h"
+#include "contabilidade_memoria.h"
+#include "afinidade.h"
 #include <iostream>
 #include <fstream>
 #include <filesystem>
@@ -16,14 +25,61 @@
 #include <cmath>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
 #include <vector>
+#include <sstream>
+#include <memory>
+
+namespace {
+
+// Gerador compartilhado pelas perturbações (semente não determinística até definirSemente)
+std::mt19937 gen{std::random_device{}()};
+std::mutex mutexGerador;
+
+uint64_t misturarSemente(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Fluxo aleatório de uma tarefa (splitmix64): barato de semear, um por perturbação
+struct GeradorTarefa {
+    using result_type = uint64_t;
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return ~0ULL; }
+    result_type operator()() { return misturarSemente(estado += 0x9E3779B97F4A7C15ULL); }
+    uint64_t estado;
+};
+
+// Fluxo da tarefa em execução na thread (nulo = gerador compartilhado)
+thread_local GeradorTarefa* geradorDaTarefa = nullptr;
+
+// Vincula o fluxo derivado de (semente, tarefa) à thread durante o escopo
+class VinculoGeradorTarefa {
+public:
+    VinculoGeradorTarefa(bool ativo, uint64_t semente, uint64_t tarefa)
+        : gerador{misturarSemente(semente ^ misturarSemente(tarefa))}, anterior(geradorDaTarefa) {
+        if (ativo) geradorDaTarefa = &gerador;
+    }
+    ~VinculoGeradorTarefa() { geradorDaTarefa = anterior; }
+    VinculoGeradorTarefa(const VinculoGeradorTarefa&) = delete;
+    VinculoGeradorTarefa& operator=(const VinculoGeradorTarefa&) = delete;
+
+private:
+    GeradorTarefa gerador;
+    GeradorTarefa* anterior;
+};
+
+} // namespace
+
+void definirSemente(uint64_t semente) {
+    std::lock_guard<std::mutex> lock(mutexGerador);
+    gen.seed(static_cast<std::mt19937::result_type>(semente ^ (semente >> 32)));
+}
 
 // Função auxiliar para gerar um número aleatório dentro de um intervalo
 int gerarNumeroAleatorio(int min, int max) {
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::mutex mutex;
-    
     // Verificar e corrigir caso o intervalo seja inválido
     if (min > max) {
         std::swap(min, max);
@@ -31,144 +87,409 @@ int gerarNumeroAleatorio(int min, int max) {
     
     std::uniform_int_distribution<> distrib(min, max);
     
+    // No modo determinístico cada tarefa tem seu próprio fluxo e não disputa o mutex
+    if (geradorDaTarefa) {
+        return distrib(*geradorDaTarefa);
+    }
+    
     // Proteger o acesso ao gerador com mutex
-    std::lock_guard<std::mutex> lock(mutex);
+    std::lock_guard<std::mutex> lock(mutexGerador);
     return distrib(gen);
 }
 
-// Função para processar um único arquivo
-void processarArquivo(const std::filesystem::path& arquivoPath, 
-                     const std::string& diretorioSaida,
-                     std::mutex& cout_mutex) {
-    std::string arquivoEntrada = arquivoPath.string();
-    std::string nomeArquivo = arquivoPath.filename().string();
-    
+double calcularLimitanteSuperior(const Deposito& deposito, const Backlog& backlog) {
+    // A razão unidades/corredores é a média do que cada corredor aberto contribui,
+    // logo não supera o estoque do maior corredor nem o UB (com um único corredor)
+    int maiorCorredor = 0;
+    for (const auto& corredor : deposito.corredor) {
+        int total = 0;
+        for (const auto& [itemId, quantidade] : corredor) {
+            total += quantidade;
+        }
+        maiorCorredor = std::max(maiorCorredor, total);
+    }
+    return std::min(backlog.wave.UB, maiorCorredor);
+}
+
+std::string formatarResumo(const ResumoInstancia& resumo) {
+    std::ostringstream linha;
+    linha << "RESULTADO instancia=" << resumo.instancia
+          << " status=" << (resumo.sucesso ? "ok" : "erro")
+          << " objetivo=" << resumo.valorObjetivo
+          << " limitante=" << resumo.limitanteSuperior
+          << " tempo=" << resumo.tempo
+          << " iteracoes=" << resumo.iteracoes
+          << " pedidos=" << resumo.numPedidos
+          << " corredores=" << resumo.numCorredores
+          << " memoria_kb=" << resumo.memoriaPico / 1024;
+    return linha.str();
+}
+
+namespace {
+
+// Instância carregada pelo estágio de leitura, com as estruturas auxiliares já construídas
+struct InstanciaCarregada {
+    size_t indice = 0;
+    std::filesystem::path arquivo;
+    InstanciaPtr instancia;
+    std::string erro;
+    std::chrono::steady_clock::time_point inicio;
+    std::shared_ptr<RegistroInstrumentacao> metricas;
+    const char* rotulo = nullptr; // nome da instância no rastreamento
+};
+
+// Solução aguardando o estágio de escrita
+struct SolucaoPendente {
+    size_t indice = 0;
+    std::string nomeArquivo;
+    Solucao solucao;
+    ResumoInstancia resumo;
+    std::chrono::steady_clock::time_point inicio;
+    std::shared_ptr<RegistroInstrumentacao> metricas;
+    const char* rotulo = nullptr; // nome da instância no rastreamento
+    UsoMemoria memoria;
+};
+
+// Estágio de leitura: interpreta o arquivo e constrói as estruturas auxiliares com as
+// threads da parcela de uma instância
+InstanciaCarregada carregarInstancia(size_t indice, const std::filesystem::path& arquivoPath,
+                                     unsigned int numThreads, CacheInstancias* cache, std::mutex& cout_mutex) {
+    InstanciaCarregada carregada;
+    carregada.indice = indice;
+    carregada.arquivo = arquivoPath;
+    carregada.inicio = std::chrono::steady_clock::now();
+    carregada.metricas = std::make_shared<RegistroInstrumentacao>();
+    VinculoInstrumentacao vinculo(carregada.metricas.get());
+    if (RastreadorEventos::ativo()) {
+        carregada.rotulo = RastreadorEventos::internar(arquivoPath.filename().string());
+    }
+    IntervaloRastreado intervalo("carregar", carregada.rotulo);
     {
         std::lock_guard<std::mutex> lock(cout_mutex);
-        std::cout << "Processando: " << nomeArquivo << std::endl;
+        std::cout << "Processando: " << arquivoPath.filename().string() << std::endl;
     }
 
     try {
-        // Carregar a instância
-        InputParser parser;
-        auto [deposito, backlog] = parser.parseFile(arquivoEntrada);
-
-        // Inicializar as estruturas auxiliares
-        LocalizadorItens localizador(deposito.numItens);
-        localizador.construir(deposito);
+        carregada.instancia = cache ? cache->obter(arquivoPath.string(), numThreads).instancia
+                                    : Instancia::carregar(arquivoPath.string(), numThreads);
+        carregada.instancia->getLocalizador();
+        carregada.instancia->getVerificador();
+        carregada.instancia->getAnalisador();
+        carregada.instancia->getAgrupador();
+    } catch (const std::exception& e) {
+        carregada.instancia.reset();
+        carregada.erro = e.what();
+    }
+    return carregada;
+}
 
-        VerificadorDisponibilidade verificador(deposito.numItens);
-        verificador.construir(deposito);
+// Estágio de resolução
+SolucaoPendente resolverInstancia(InstanciaCarregada carregada, const ConfiguracaoSolver& configuracao,
+                                  std::mutex& cout_mutex) {
+    SolucaoPendente pendente;
+    pendente.indice = carregada.indice;
+    pendente.nomeArquivo = carregada.arquivo.filename().string();
+    pendente.resumo.instancia = carregada.arquivo.stem().string();
+    pendente.inicio = carregada.inicio;
+    pendente.metricas = carregada.metricas;
+    pendente.rotulo = carregada.rotulo;
+    VinculoInstrumentacao vinculo(pendente.metricas.get());
+    IntervaloRastreado intervalo("resolver", pendente.rotulo);
+
+    // Falhas de leitura chegam com a instância vazia e seguem para o relatório
+    if (carregada.instancia) {
+        try {
+            const InstanciaPtr& instancia = carregada.instancia;
+            const Deposito& deposito = instancia->getDeposito();
+            const Backlog& backlog = instancia->getBacklog();
+            VinculoMemoria vinculoMemoria(&instancia->getMemoria());
+            pendente.solucao = resolverWave(deposito, backlog, instancia->getLocalizador(), instancia->getVerificador(),
+                                            instancia->getAnalisador(), instancia->getAgrupador(),
+                                            nullptr, configuracao, &pendente.resumo.iteracoes);
+
+            pendente.resumo.valorObjetivo = pendente.solucao.valorObjetivo;
+            pendente.resumo.limitanteSuperior = calcularLimitanteSuperior(deposito, backlog);
+            pendente.resumo.numPedidos = static_cast<int>(pendente.solucao.pedidosWave.size());
+            pendente.resumo.numCorredores = static_cast<int>(pendente.solucao.corredoresWave.size());
+            pendente.memoria = instancia->getMemoria().ler();
+            pendente.resumo.memoriaPico = pendente.memoria.picoTotal;
+            pendente.resumo.sucesso = true;
+        } catch (const std::exception& e) {
+            carregada.erro = e.what();
+        }
+    }
+    if (!carregada.erro.empty()) {
+        std::lock_guard<std::mutex> lock(cout_mutex);
+        std::cerr << "Erro ao processar arquivo " << pendente.nomeArquivo << ": " << carregada.erro << std::endl;
+    }
+    return pendente;
+}
 
-        AnalisadorRelevancia analisador(backlog.numPedidos);
-        analisador.construir(backlog, localizador);
+} // namespace
+
+Solucao resolverWave(const Deposito& deposito, const Backlog& backlog,
+                     const LocalizadorItens& localizador,
+                     const VerificadorDisponibilidade& verificador,
+                     const AnalisadorRelevancia& analisador,
+                     const AgrupadorPedidos& agrupador,
+                     const CallbackIncumbente& aoMelhorar,
+                     const ConfiguracaoSolver& configuracao,
+                     int* iteracoesExecutadas) {
+    auto inicio = std::chrono::steady_clock::now();
+    if (iteracoesExecutadas) *iteracoesExecutadas = 0;
+    
+    // Gerar solução inicial usando as estruturas auxiliares
+    Solucao solucaoInicial;
+    if (configuracao.algoritmo == "janela") {
+        solucaoInicial.valorObjetivo = 0.0;
+    } else {
+        solucaoInicial = gerarSolucaoInicial(deposito, backlog, localizador, verificador, analisador);
+    }
+    
+    // O algoritmo guloso para na solução inicial ajustada
+    if (configuracao.algoritmo == "guloso") {
+        return ajustarSolucao(deposito, backlog, solucaoInicial, localizador, verificador, analisador,
+                              configuracao.numThreads);
+    }
 
-        // Gerar solução inicial usando as estruturas auxiliares
-        Solucao solucaoInicial = gerarSolucaoInicial(deposito, backlog, localizador, verificador, analisador);
+    // Usar a melhor wave semeada pelos clusters, se superar a solução gulosa
+    if (configuracao.algoritmo != "janela") {
+        for (Solucao& semente : gerarSolucoesPorClusters(deposito, backlog, localizador, verificador,
+                                                         analisador, agrupador)) {
+            if (semente.valorObjetivo > solucaoInicial.valorObjetivo) {
+                solucaoInicial = std::move(semente);
+            }
+        }
+    }
 
-        // Otimizar a solução usando as estruturas auxiliares
-        Solucao solucaoOtima = otimizarSolucao(deposito, backlog, solucaoInicial, localizador, verificador, analisador);
+    // Considerar também a melhor janela contígua da lista ordenada por relevância
+    {
+        INSTRUMENTAR_FASE(FASE_CONSTRUCAO);
+        SeletorWaves seletor;
+        auto melhorJanela = seletor.selecionarWaveOtima(backlog, analisador.getPedidosOrdenadosPorRelevancia(),
+                                                        analisador, localizador, configuracao.numThreads);
+        if (!melhorJanela.corredoresNecessarios.empty()) {
+            Solucao solucaoJanela;
+            solucaoJanela.pedidosWave = ConjuntoPedidos(melhorJanela.pedidosIds);
+            solucaoJanela.corredoresWave = SeletorCorredores(localizador).selecionar(backlog, solucaoJanela.pedidosWave);
+            solucaoJanela.valorObjetivo = calcularValorObjetivo(deposito, backlog, solucaoJanela);
+            if (solucaoJanela.valorObjetivo > solucaoInicial.valorObjetivo) {
+                solucaoInicial = std::move(solucaoJanela);
+            }
+        }
+    }
 
-        // Ajustar a solução final para garantir viabilidade
-        Solucao solucaoFinal = ajustarSolucao(deposito, backlog, solucaoOtima, localizador, verificador);
+    if (configuracao.algoritmo == "janela") {
+        return ajustarSolucao(deposito, backlog, solucaoInicial, localizador, verificador, analisador,
+                              configuracao.numThreads);
+    }
 
-        // Salvar a solução
-        salvarSolucao(diretorioSaida, nomeArquivo, solucaoFinal);
+    // A busca compara soluções ainda não ajustadas; cada solução aceita é ajustada uma única
+    // vez e a melhor versão viável é guardada (e repassada ao chamador quando melhora)
+    Solucao melhorAjustada = ajustarSolucao(deposito, backlog, solucaoInicial, localizador, verificador, analisador,
+                                            configuracao.numThreads);
+    if (aoMelhorar) {
+        aoMelhorar(melhorAjustada);
+    }
+    auto registrarCandidata = [&](const Solucao& candidata) {
+        Solucao ajustada = ajustarSolucao(deposito, backlog, candidata, localizador, verificador, analisador,
+                                          configuracao.numThreads);
+        if (ajustada.valorObjetivo > melhorAjustada.valorObjetivo) {
+            melhorAjustada = std::move(ajustada);
+            if (aoMelhorar) {
+                aoMelhorar(melhorAjustada);
+            }
+        }
+    };
 
-    } catch (const std::exception& e) {
-        std::lock_guard<std::mutex> lock(cout_mutex);
-        std::cerr << "Erro ao processar arquivo " << nomeArquivo << ": " << e.what() << std::endl;
+    // Otimizar a solução usando as estruturas auxiliares, no tempo que restar do limite
+    ConfiguracaoSolver configuracaoBusca = configuracao;
+    if (configuracao.tempoLimite > 0.0) {
+        double decorrido = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        configuracaoBusca.tempoLimite = std::max(1e-9, configuracao.tempoLimite - decorrido);
     }
+    // A solução devolvida pela busca é a última aceita, já ajustada em registrarCandidata
+    otimizarSolucao(deposito, backlog, solucaoInicial, localizador, verificador, analisador,
+                    configuracaoBusca, registrarCandidata, iteracoesExecutadas);
+
+    return melhorAjustada;
 }
 
-void solucionarDesafio(const std::string& diretorioEntrada, const std::string& diretorioSaida) {
+std::vector<ResumoInstancia> solucionarDesafio(const std::string& diretorioEntrada, const std::string& diretorioSaida,
+                                               const ConfiguracaoSolver& configuracao,
+                                               CacheInstancias* cache) {
     // 1. Criar diretório de saída se não existir
     if (!std::filesystem::exists(diretorioSaida)) {
-        std::filesystem::create_directory(diretorioSaida);
+        std::filesystem::create_directories(diretorioSaida);
     }
 
-    // 2. Coletar todos os arquivos primeiro
+    // 2. Coletar todos os arquivos primeiro (ou o próprio arquivo, se a entrada for um arquivo)
     std::vector<std::filesystem::path> arquivos;
-    for (const auto& entry : std::filesystem::directory_iterator(diretorioEntrada)) {
-        if (entry.is_regular_file() && entry.path().extension() == ".txt") {
-            arquivos.push_back(entry.path());
+    if (std::filesystem::is_regular_file(diretorioEntrada)) {
+        arquivos.push_back(diretorioEntrada);
+    } else {
+        for (const auto& entry : std::filesystem::directory_iterator(diretorioEntrada)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".txt") {
+                arquivos.push_back(entry.path());
+            }
         }
+        std::sort(arquivos.begin(), arquivos.end());
+    }
+    if (configuracao.semente != 0) {
+        definirSemente(configuracao.semente);
     }
     
     // 3. Determinar o número de threads a utilizar
-    unsigned int numThreads = std::thread::hardware_concurrency();
+    unsigned int numThreads = configuracao.numThreads;
+    if (numThreads == 0) numThreads = std::thread::hardware_concurrency();
     if (numThreads == 0) numThreads = 4; // Fallback se hardware_concurrency() retornar 0
     
-    // Limitar número de threads ao número de arquivos
-    numThreads = std::min(numThreads, static_cast<unsigned int>(arquivos.size()));
+    // Instâncias em paralelo limitadas ao número de arquivos; as threads restantes vão para a busca
+    unsigned int totalThreads = numThreads;
+    numThreads = std::max(1u, std::min(numThreads, static_cast<unsigned int>(arquivos.size())));
+    ConfiguracaoSolver configuracaoInstancia = configuracao;
+    configuracaoInstancia.numThreads = std::max(1u, totalThreads / numThreads);
+    
+    // Grupos de threads: com afinidade, um por nó NUMA, cada um com sua leitura e sua fila, de
+    // modo que as estruturas de uma instância sejam tocadas primeiro (e alocadas) no nó das
+    // threads que a resolvem; as instâncias são distribuídas entre os grupos em rodízio.
+    // Sem afinidade há um único grupo, sem fixação.
+    bool comAfinidade = configuracao.afinidade != "nenhuma";
+    std::vector<std::vector<int>> cpusPorGrupo(1);
+    if (comAfinidade) {
+        cpusPorGrupo = TopologiaNuma::detectar(configuracao.nosNuma).cpusPorNo;
+        if (cpusPorGrupo.size() > numThreads) cpusPorGrupo.resize(numThreads);
+    }
+    size_t numGrupos = cpusPorGrupo.size();
+    
+    // CPUs de cada thread de resolução: o nó inteiro, ou no modo "cpu" uma fatia própria do nó
+    // para as threads da sua busca
+    std::vector<std::vector<int>> cpusPorThread(numThreads);
+    for (unsigned int t = 0; comAfinidade && t < numThreads; t++) {
+        const std::vector<int>& cpusNo = cpusPorGrupo[t % numGrupos];
+        if (configuracao.afinidade != "cpu") {
+            cpusPorThread[t] = cpusNo;
+            continue;
+        }
+        size_t threadsNoGrupo = (numThreads - t % numGrupos + numGrupos - 1) / numGrupos;
+        size_t posicao = t / numGrupos;
+        size_t inicioFatia = posicao * cpusNo.size() / threadsNoGrupo;
+        size_t fimFatia = std::max(inicioFatia + 1, (posicao + 1) * cpusNo.size() / threadsNoGrupo);
+        for (size_t c = inicioFatia; c < fimFatia; c++) {
+            cpusPorThread[t].push_back(cpusNo[c % cpusNo.size()]);
+        }
+    }
     
-    // 4. Criar mutex para proteção da saída de console
+    // 4. Pipeline leitura -> resolução -> escrita ligado por filas limitadas: a leitura se adianta
+    //    no máximo uma instância por thread de resolução e a escrita não bloqueia a busca
     std::mutex cout_mutex;
+    std::vector<ResumoInstancia> resumos(arquivos.size());
+    std::vector<UsoMemoria> usosMemoria(arquivos.size());
+    std::vector<std::unique_ptr<FilaLimitada<InstanciaCarregada>>> filasCarregadas;
+    for (size_t g = 0; g < numGrupos; g++) {
+        filasCarregadas.push_back(std::make_unique<FilaLimitada<InstanciaCarregada>>(
+            (numThreads + numGrupos - 1 - g) / numGrupos));
+    }
+    FilaLimitada<SolucaoPendente> filaEscrita(2 * numThreads);
     
-    // 5. Criar e iniciar threads
-    std::vector<std::thread> threads;
+    std::vector<std::thread> leituras;
+    for (size_t g = 0; g < numGrupos; g++) {
+        leituras.emplace_back([&, g]() {
+            if (comAfinidade) fixarThreadEmCpus(cpusPorGrupo[g]);
+            for (size_t i = g; i < arquivos.size(); i += numGrupos) {
+                if (!filasCarregadas[g]->inserir(carregarInstancia(i, arquivos[i], configuracaoInstancia.numThreads,
+                                                                   cache, cout_mutex))) break;
+            }
+            filasCarregadas[g]->fechar();
+        });
+    }
+    
+    std::thread escrita([&]() {
+        SolucaoPendente pendente;
+        while (filaEscrita.retirar(pendente)) {
+            VinculoInstrumentacao vinculo(pendente.metricas.get());
+            IntervaloRastreado intervalo("escrever", pendente.rotulo);
+            if (pendente.resumo.sucesso && !salvarSolucao(diretorioSaida, pendente.nomeArquivo, pendente.solucao)) {
+                pendente.resumo.sucesso = false;
+            }
+            if (INSTRUMENTACAO_HABILITADA) {
+                std::ofstream metricas(diretorioSaida + "/" + pendente.resumo.instancia + ".metricas.json");
+                pendente.metricas->escreverJson(metricas, pendente.resumo.instancia);
+            }
+            pendente.resumo.tempo =
+                std::chrono::duration<double>(std::chrono::steady_clock::now() - pendente.inicio).count();
+            {
+                // O mutex protege só a linha de resumo; a gravação acima não bloqueia os outros estágios
+                std::lock_guard<std::mutex> lock(cout_mutex);
+                std::cout << formatarResumo(pendente.resumo) << std::endl;
+            }
+            usosMemoria[pendente.indice] = pendente.memoria;
+            resumos[pendente.indice] = std::move(pendente.resumo);
+        }
+    });
     
+    // 5. Criar e iniciar as threads de resolução
+    std::vector<std::thread> threads;
     for (unsigned int t = 0; t < numThreads; t++) {
-        threads.emplace_back([t, numThreads, &arquivos, &diretorioSaida, &cout_mutex]() {
-            // Cada thread processa uma fração dos arquivos
-            for (size_t i = t; i < arquivos.size(); i += numThreads) {
-                processarArquivo(arquivos[i], diretorioSaida, cout_mutex);
+        threads.emplace_back([&, t]() {
+            // As threads da busca herdam a máscara da thread de resolução
+            if (comAfinidade) fixarThreadEmCpus(cpusPorThread[t]);
+            InstanciaCarregada carregada;
+            while (filasCarregadas[t % numGrupos]->retirar(carregada)) {
+                filaEscrita.inserir(resolverInstancia(std::move(carregada), configuracaoInstancia, cout_mutex));
             }
         });
     }
     
-    // 6. Aguardar término de todas as threads
+    // 6. Aguardar término de todos os estágios
+    for (auto& leitura : leituras) {
+        leitura.join();
+    }
     for (auto& thread : threads) {
         thread.join();
     }
+    filaEscrita.fechar();
+    escrita.join();
+    
+    // 7. Uso de memória por instância e do processo (a conta global soma instâncias simultâneas)
+    std::ofstream memoria(diretorioSaida + "/memoria.json");
+    memoria << "{\n  \"instancias\": {";
+    for (size_t i = 0; i < resumos.size(); i++) {
+        memoria << (i ? ",\n" : "\n") << "    \"" << resumos[i].instancia << "\": ";
+        escreverUsoMemoriaJson(memoria, usosMemoria[i]);
+    }
+    memoria << "\n  },\n  \"total\": ";
+    escreverUsoMemoriaJson(memoria, ContabilidadeMemoria::global().ler());
+    memoria << "\n}\n";
+    
+    return resumos;
 }
 
 Solucao gerarSolucaoInicial(const Deposito& deposito, const Backlog& backlog, 
                            const LocalizadorItens& localizador, 
                            const VerificadorDisponibilidade& verificador,
                            const AnalisadorRelevancia& analisador) {
+    INSTRUMENTAR_FASE(FASE_CONSTRUCAO);
     Solucao solucao;
     solucao.valorObjetivo = 0.0;
 
     // Usar o AnalisadorRelevancia para obter pedidos ordenados por relevância
-    std::vector<int> pedidosOrdenados = analisador.getPedidosOrdenadosPorRelevancia();
+    const std::vector<int>& pedidosOrdenados = analisador.getPedidosOrdenadosPorRelevancia();
     
     // Adicionar pedidos até atingir o limite inferior da wave
     int unidadesNaWave = 0;
-    std::unordered_set<int> corredoresNecessarios;
     
     for (int pedidoId : pedidosOrdenados) {
         // Verificar se o pedido pode ser atendido com o estoque atual
-        if (!verificador.verificarDisponibilidade(backlog.pedido[pedidoId])) {
+        if (!verificador.pedidoAtendivel(pedidoId)) {
             continue;
         }
         
-        int unidadesPedido = analisador.infoPedidos[pedidoId].numUnidades;
+        int unidadesPedido = analisador.numUnidades[pedidoId];
 
         if (unidadesNaWave + unidadesPedido <= backlog.wave.UB) {
-            solucao.pedidosWave.push_back(pedidoId);
+            solucao.pedidosWave.inserir(pedidoId);
             unidadesNaWave += unidadesPedido;
-            
-            // Adicionar corredores necessários para este pedido
-            for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
-                // Usar o LocalizadorItens para encontrar os corredores com este item
-                const auto& corredoresComItem = localizador.getCorredoresComItem(itemId);
-                
-                int quantidadeRestante = quantidade;
-                
-                // Ordenar corredores por quantidade disponível
-                std::vector<std::pair<int, int>> corredoresOrdenados(
-                    corredoresComItem.begin(), corredoresComItem.end());
-                std::sort(corredoresOrdenados.begin(), corredoresOrdenados.end(),
-                    [](const auto& a, const auto& b) { return a.second > b.second; });
-                
-                for (const auto& [corredorId, quantidadeDisponivel] : corredoresOrdenados) {
-                    if (quantidadeRestante <= 0) break;
-                    
-                    corredoresNecessarios.insert(corredorId);
-                    quantidadeRestante -= std::min(quantidadeRestante, quantidadeDisponivel);
-                }
-            }
         }
 
         if (unidadesNaWave >= backlog.wave.LB) {
@@ -176,7 +497,9 @@ Solucao gerarSolucaoInicial(const Deposito& deposito, const Backlog& backlog,
         }
     }
     
-    solucao.corredoresWave.assign(corredoresNecessarios.begin(), corredoresNecessarios.end());
+    // Escolher os corredores para o conjunto de pedidos selecionado
+    SeletorCorredores seletorCorredores(localizador);
+    solucao.corredoresWave = seletorCorredores.selecionar(backlog, solucao.pedidosWave);
     
     // Calcular o valor objetivo da solução inicial
     solucao.valorObjetivo = calcularValorObjetivo(deposito, backlog, solucao);
@@ -184,11 +507,83 @@ Solucao gerarSolucaoInicial(const Deposito& deposito, const Backlog& backlog,
     return solucao;
 }
 
+std::vector<Solucao> gerarSolucoesPorClusters(const Deposito& deposito, const Backlog& backlog,
+                                              const LocalizadorItens& localizador,
+                                              const VerificadorDisponibilidade& verificador,
+                                              const AnalisadorRelevancia& analisador,
+                                              const AgrupadorPedidos& agrupador,
+                                              int maxSementes) {
+    INSTRUMENTAR_FASE(FASE_CONSTRUCAO);
+    std::vector<Solucao> solucoes;
+    const std::vector<int>& pedidosOrdenados = analisador.getPedidosOrdenadosPorRelevancia();
+    SeletorCorredores seletorCorredores(localizador);
+    
+    int numSementes = std::min(maxSementes, static_cast<int>(agrupador.clusters.size()));
+    for (int c = 0; c < numSementes; c++) {
+        // Clusters unitários não trazem compartilhamento de corredores
+        if (agrupador.clusters[c].size() < 2) break;
+        
+        Solucao solucao;
+        int unidadesNaWave = 0;
+        
+        auto adicionarPedido = [&](int pedidoId) {
+            int unidadesPedido = analisador.numUnidades[pedidoId];
+            if (solucao.pedidosWave.contem(pedidoId) || unidadesNaWave + unidadesPedido > backlog.wave.UB ||
+                !verificador.pedidoAtendivel(pedidoId)) {
+                return;
+            }
+            solucao.pedidosWave.inserir(pedidoId);
+            unidadesNaWave += unidadesPedido;
+        };
+        
+        // Adicionar os pedidos do cluster, dos mais relevantes para os menos relevantes
+        std::vector<int> pedidosCluster = agrupador.clusters[c];
+        std::sort(pedidosCluster.begin(), pedidosCluster.end(),
+            [&analisador](int a, int b) {
+                return analisador.pontuacaoRelevancia[a] > 
+                       analisador.pontuacaoRelevancia[b];
+            });
+        for (int pedidoId : pedidosCluster) {
+            adicionarPedido(pedidoId);
+        }
+        
+        // Completar com os pedidos mais relevantes caso o cluster não atinja o limite inferior
+        for (int pedidoId : pedidosOrdenados) {
+            if (unidadesNaWave >= backlog.wave.LB) break;
+            adicionarPedido(pedidoId);
+        }
+        
+        if (unidadesNaWave < backlog.wave.LB) {
+            continue;
+        }
+        
+        solucao.corredoresWave = seletorCorredores.selecionar(backlog, solucao.pedidosWave);
+        if (solucao.corredoresWave.empty()) {
+            continue;
+        }
+        solucao.valorObjetivo = calcularValorObjetivo(deposito, backlog, solucao);
+        solucoes.push_back(std::move(solucao));
+    }
+    
+    return solucoes;
+}
+
 Solucao perturbarSolucao(const Deposito& deposito, const Backlog& backlog, const Solucao& solucaoAtual,
                          const LocalizadorItens& localizador, 
                          const VerificadorDisponibilidade& verificador,
                          const AnalisadorRelevancia& analisador) {
-    Solucao solucaoPerturbada = solucaoAtual;
+    AreaTrabalhoBusca area(localizador);
+    Solucao solucaoPerturbada;
+    perturbarSolucao(deposito, backlog, solucaoAtual, verificador, analisador, area, solucaoPerturbada);
+    return solucaoPerturbada;
+}
+
+void perturbarSolucao(const Deposito& deposito, const Backlog& backlog, const Solucao& solucaoAtual,
+                      const VerificadorDisponibilidade& verificador,
+                      const AnalisadorRelevancia& analisador,
+                      AreaTrabalhoBusca& area, Solucao& solucaoPerturbada) {
+    INSTRUMENTAR_CONTADOR(CONTADOR_PERTURBACOES, 1);
+    solucaoPerturbada.pedidosWave.atribuir(solucaoAtual.pedidosWave);
 
     // Perturbar a solução: remover alguns pedidos aleatoriamente
     if (!solucaoPerturbada.pedidosWave.empty()) {
@@ -199,77 +594,34 @@ Solucao perturbarSolucao(const Deposito& deposito, const Backlog& backlog, const
         
         for (int i = 0; i < numPedidosRemover && !solucaoPerturbada.pedidosWave.empty(); i++) {
             int indexRemover = gerarNumeroAleatorio(0, solucaoPerturbada.pedidosWave.size() - 1);
-            solucaoPerturbada.pedidosWave.erase(solucaoPerturbada.pedidosWave.begin() + indexRemover);
-        }
-    }
-
-    // Recalcular os corredores necessários usando o LocalizadorItens
-    std::unordered_set<int> corredoresNecessarios;
-    for (int pedidoId : solucaoPerturbada.pedidosWave) {
-        for (const auto& [itemId, quantidadeSolicitada] : backlog.pedido[pedidoId]) {
-            const auto& corredoresComItem = localizador.getCorredoresComItem(itemId);
-            
-            int quantidadeRestante = quantidadeSolicitada;
-            
-            // Ordenar corredores por quantidade disponível
-            std::vector<std::pair<int, int>> corredoresOrdenados(
-                corredoresComItem.begin(), corredoresComItem.end());
-            std::sort(corredoresOrdenados.begin(), corredoresOrdenados.end(),
-                [](const auto& a, const auto& b) { return a.second > b.second; });
-            
-            for (const auto& [corredorId, quantidadeDisponivel] : corredoresOrdenados) {
-                if (quantidadeRestante <= 0) break;
-                
-                corredoresNecessarios.insert(corredorId);
-                quantidadeRestante -= std::min(quantidadeRestante, quantidadeDisponivel);
-            }
+            solucaoPerturbada.pedidosWave.removerNaPosicao(indexRemover);
         }
     }
-    solucaoPerturbada.corredoresWave.assign(corredoresNecessarios.begin(), corredoresNecessarios.end());
 
     // Obter pedidos ordenados por relevância
-    std::vector<int> pedidosOrdenados = analisador.getPedidosOrdenadosPorRelevancia();
+    const std::vector<int>& pedidosOrdenados = analisador.getPedidosOrdenadosPorRelevancia();
     
     // Adicionar novos pedidos relevantes até atingir o limite superior da wave
     int unidadesNaWave = 0;
     for (int pedidoId : solucaoPerturbada.pedidosWave) {
-        unidadesNaWave += analisador.infoPedidos[pedidoId].numUnidades;
+        unidadesNaWave += analisador.numUnidades[pedidoId];
     }
 
+    uint64_t movimentosAvaliados = 0;
     for (int pedidoId : pedidosOrdenados) {
         // Pular pedidos que já estão na wave
-        if (std::find(solucaoPerturbada.pedidosWave.begin(), solucaoPerturbada.pedidosWave.end(), pedidoId) 
-            != solucaoPerturbada.pedidosWave.end()) {
+        if (solucaoPerturbada.pedidosWave.contem(pedidoId)) {
             continue;
         }
         
-        int unidadesPedido = analisador.infoPedidos[pedidoId].numUnidades;
+        movimentosAvaliados++;
+        int unidadesPedido = analisador.numUnidades[pedidoId];
 
         if (unidadesNaWave + unidadesPedido <= backlog.wave.UB) {
             // Verificar se há estoque disponível usando o VerificadorDisponibilidade
-            if (verificador.verificarDisponibilidade(backlog.pedido[pedidoId])) {
-                solucaoPerturbada.pedidosWave.push_back(pedidoId);
+            if (verificador.pedidoAtendivel(pedidoId)) {
+                solucaoPerturbada.pedidosWave.inserir(pedidoId);
                 unidadesNaWave += unidadesPedido;
-                
-                // Atualizar corredores necessários
-                for (const auto& [itemId, quantidadeSolicitada] : backlog.pedido[pedidoId]) {
-                    const auto& corredoresComItem = localizador.getCorredoresComItem(itemId);
-                    
-                    int quantidadeRestante = quantidadeSolicitada;
-                    
-                    // Ordenar corredores por quantidade disponível
-                    std::vector<std::pair<int, int>> corredoresOrdenados(
-                        corredoresComItem.begin(), corredoresComItem.end());
-                    std::sort(corredoresOrdenados.begin(), corredoresOrdenados.end(),
-                        [](const auto& a, const auto& b) { return a.second > b.second; });
-                    
-                    for (const auto& [corredorId, quantidadeDisponivel] : corredoresOrdenados) {
-                        if (quantidadeRestante <= 0) break;
-                        
-                        corredoresNecessarios.insert(corredorId);
-                        quantidadeRestante -= std::min(quantidadeRestante, quantidadeDisponivel);
-                    }
-                }
             }
         }
 
@@ -277,85 +629,189 @@ Solucao perturbarSolucao(const Deposito& deposito, const Backlog& backlog, const
             break;
         }
     }
+    INSTRUMENTAR_CONTADOR(CONTADOR_MOVIMENTOS_AVALIADOS, movimentosAvaliados);
+    (void)movimentosAvaliados;
 
-    // Atualizar corredores necessários
-    solucaoPerturbada.corredoresWave.assign(corredoresNecessarios.begin(), corredoresNecessarios.end());
+    // Escolher os corredores para o novo conjunto de pedidos
+    area.seletor.selecionar(backlog, solucaoPerturbada.pedidosWave.ids(), solucaoPerturbada.corredoresWave);
 
     // Recalcular o valor objetivo
     solucaoPerturbada.valorObjetivo = calcularValorObjetivo(deposito, backlog, solucaoPerturbada);
-
-    return solucaoPerturbada;
 }
 
+namespace {
+
+// Área de trabalho de uma thread da busca e as reservas dos seus buffers na conta de memória:
+// vivem durante toda a chamada de otimizarSolucao e são reajustadas quando os vetores crescem
+struct TrabalhoThreadBusca {
+    explicit TrabalhoThreadBusca(const LocalizadorItens& localizador)
+        : area(localizador), reservaArea(MEMORIA_AREA_TRABALHO, bytesEstimados(area)),
+          reservaSolucao(MEMORIA_SOLUCOES, 0) {}
+    AreaTrabalhoBusca area;
+    ReservaMemoria reservaArea;
+    ReservaMemoria reservaSolucao;
+};
+
+} // namespace
+
 Solucao otimizarSolucao(const Deposito& deposito, const Backlog& backlog, const Solucao& solucaoInicial,
                         const LocalizadorItens& localizador, 
                         const VerificadorDisponibilidade& verificador,
-                        const AnalisadorRelevancia& analisador) {
-    const int MAX_ITERACOES = 100;
+                        const AnalisadorRelevancia& analisador,
+                        const ConfiguracaoSolver& configuracao,
+                        const CallbackIncumbente& aoMelhorar,
+                        int* iteracoesExecutadas) {
+    INSTRUMENTAR_FASE(FASE_OTIMIZACAO);
+    RegistroInstrumentacao* metricas = RegistroInstrumentacao::atual();
+    ContabilidadeMemoria* memoria = &ContabilidadeMemoria::atual();
+    const int maxIteracoes = configuracao.maxIteracoes;
+    auto inicio = std::chrono::steady_clock::now();
     
     // Determinar número de threads
-    unsigned int numThreads = std::thread::hardware_concurrency();
-    if (numThreads == 0) numThreads = 4;
-    numThreads = std::min(numThreads, 8u); // Limitar threads para evitar sobrecarga
+    unsigned int numThreads = configuracao.numThreads;
+    if (numThreads == 0) {
+        numThreads = std::thread::hardware_concurrency();
+        if (numThreads == 0) numThreads = 4;
+        numThreads = std::min(numThreads, 8u); // Limitar threads para evitar sobrecarga
+    }
+    int iteracoes = 0;
     
     Solucao melhorSolucao = solucaoInicial;
+    double melhorValorBruto = solucaoInicial.valorObjetivo;
     double lambda = 0.0;
-    std::mutex melhorSolucaoMutex;
     
-    for (int iteracao = 0; iteracao < MAX_ITERACOES; iteracao += numThreads) {
-        // Preparar estruturas para trabalho paralelo
-        std::vector<Solucao> solucoesPerturbadas(numThreads);
-        std::vector<double> numeradores(numThreads, -1.0);
-        std::vector<std::thread> threads;
+    // Buffers por thread, reaproveitados entre rodadas: a perturbação t é gravada em
+    // solucoesPerturbadas[t] usando a área de trabalho da thread que a executa
+    std::vector<Solucao> solucoesPerturbadas(numThreads);
+    std::vector<double> numeradores(numThreads, -1.0);
+    
+    // No modo determinístico a perturbação de índice global k (rodada * numThreads + t) sorteia
+    // de um fluxo derivado de (semente, k), qualquer que seja a thread que a execute, e a
+    // escolha da melhor segue a ordem dos índices; o resultado depende só da semente e do
+    // número de threads
+    int iteracaoAtual = 0;
+    auto executarPerturbacao = [&](unsigned int t, TrabalhoThreadBusca& trabalho) {
+        IntervaloRastreado intervalo("perturbacao");
+        VinculoGeradorTarefa vinculoGerador(configuracao.deterministico, configuracao.semente,
+                                            static_cast<uint64_t>(iteracaoAtual) + t);
+        Solucao& perturbada = solucoesPerturbadas[t];
+        perturbarSolucao(deposito, backlog, melhorSolucao, verificador, analisador, trabalho.area, perturbada);
+        trabalho.reservaSolucao.ajustar(bytesEstimados(perturbada));
+        trabalho.reservaArea.ajustar(bytesEstimados(trabalho.area));
         
-        // Lançar threads para gerar e avaliar perturbações em paralelo
-        for (unsigned int t = 0; t < numThreads && (iteracao + t) < MAX_ITERACOES; t++) {
-            threads.emplace_back([t, &deposito, &backlog, &melhorSolucao, &solucoesPerturbadas,
-                                 &numeradores, &localizador, &verificador, &analisador, lambda]() {
-                // Criar uma cópia da solução atual para perturbar
-                Solucao solucaoAtual = melhorSolucao;
-                
-                // Perturbar e avaliar a solução
-                solucoesPerturbadas[t] = perturbarSolucao(deposito, backlog, solucaoAtual,
-                                                         localizador, verificador, analisador);
-                
-                if (!solucoesPerturbadas[t].corredoresWave.empty()) {
-                    double totalUnidades = 0.0;
-                    for (int pedidoId : solucoesPerturbadas[t].pedidosWave) {
-                        totalUnidades += analisador.infoPedidos[pedidoId].numUnidades;
-                    }
-                    
-                    numeradores[t] = totalUnidades - lambda * solucoesPerturbadas[t].corredoresWave.size();
+        numeradores[t] = -1.0;
+        if (!perturbada.corredoresWave.empty()) {
+            double totalUnidades = 0.0;
+            for (int pedidoId : perturbada.pedidosWave) {
+                totalUnidades += analisador.numUnidades[pedidoId];
+            }
+            numeradores[t] = totalUnidades - lambda * perturbada.corredoresWave.size();
+        }
+    };
+    
+    // A thread chamadora executa a perturbação 0; as demais ficam em threads criadas uma vez
+    // por chamada, que aguardam o início de cada rodada (melhorSolucao e lambda só mudam
+    // entre rodadas, com todas as threads paradas)
+    std::mutex mutexRodada;
+    std::condition_variable inicioRodada, fimRodada;
+    uint64_t rodada = 0;
+    unsigned int perturbacoesNaRodada = 0;
+    unsigned int pendentes = 0;
+    bool encerrar = false;
+    
+    // No modo "cpu", cada thread da busca fica numa CPU da máscara da thread chamadora
+    std::vector<int> cpusBusca;
+    if (configuracao.afinidade == "cpu") cpusBusca = cpusDaThread();
+    
+    std::vector<std::thread> threads;
+    for (unsigned int t = 1; t < numThreads && static_cast<int>(t) < maxIteracoes; t++) {
+        threads.emplace_back([&, t]() {
+            if (!cpusBusca.empty()) fixarThreadEmCpus({cpusBusca[t % cpusBusca.size()]});
+            VinculoInstrumentacao vinculo(metricas);
+            VinculoMemoria vinculoMemoria(memoria);
+            TrabalhoThreadBusca trabalho(localizador);
+            uint64_t rodadaVista = 0;
+            while (true) {
+                {
+                    std::unique_lock<std::mutex> lock(mutexRodada);
+                    inicioRodada.wait(lock, [&]() { return encerrar || rodada != rodadaVista; });
+                    if (encerrar) return;
+                    rodadaVista = rodada;
+                    if (t >= perturbacoesNaRodada) continue;
                 }
-            });
+                executarPerturbacao(t, trabalho);
+                std::lock_guard<std::mutex> lock(mutexRodada);
+                if (--pendentes == 0) fimRodada.notify_one();
+            }
+        });
+    }
+    TrabalhoThreadBusca trabalhoPrincipal(localizador);
+    
+    for (int iteracao = 0; iteracao < maxIteracoes; iteracao += numThreads) {
+        // Respeitar o tempo limite (verificado entre rodadas de perturbações)
+        if (!configuracao.deterministico && configuracao.tempoLimite > 0.0 &&
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count() >= configuracao.tempoLimite) {
+            break;
         }
+        iteracaoAtual = iteracao;
+        unsigned int numPerturbacoes = static_cast<unsigned int>(
+            std::min(static_cast<int>(numThreads), maxIteracoes - iteracao));
+        iteracoes += static_cast<int>(numPerturbacoes);
+        IntervaloRastreado intervaloRodada("rodada");
         
-        // Aguardar threads
-        for (auto& thread : threads) {
-            thread.join();
+        // Gerar e avaliar as perturbações em paralelo
+        if (numPerturbacoes > 1) {
+            std::lock_guard<std::mutex> lock(mutexRodada);
+            perturbacoesNaRodada = numPerturbacoes;
+            pendentes = numPerturbacoes - 1;
+            rodada++;
+            inicioRodada.notify_all();
+        }
+        executarPerturbacao(0, trabalhoPrincipal);
+        {
+            std::unique_lock<std::mutex> lock(mutexRodada);
+            fimRodada.wait(lock, [&]() { return pendentes == 0; });
         }
         
         // Encontrar a melhor perturbação entre as geradas
         double melhorNumerador = -1.0;
         int melhorIndice = -1;
         
-        for (unsigned int t = 0; t < numThreads && (iteracao + t) < MAX_ITERACOES; t++) {
+        for (unsigned int t = 0; t < numPerturbacoes; t++) {
             if (numeradores[t] > melhorNumerador) {
                 melhorNumerador = numeradores[t];
                 melhorIndice = t;
             }
         }
         
-        // Atualizar melhor solução
+        // Atualizar melhor solução (a troca devolve os buffers da anterior para a thread t)
         if (melhorIndice >= 0 && melhorNumerador > 0) {
-            std::lock_guard<std::mutex> lock(melhorSolucaoMutex);
-            melhorSolucao = solucoesPerturbadas[melhorIndice];
+            std::swap(melhorSolucao, solucoesPerturbadas[melhorIndice]);
+            if (melhorSolucao.valorObjetivo > melhorValorBruto) {
+                melhorValorBruto = melhorSolucao.valorObjetivo;
+                INSTRUMENTAR_CONTADOR(CONTADOR_MELHORIAS, 1);
+                RastreadorEventos::registrarInstante("melhoria", melhorValorBruto);
+            }
+            // Toda solução aceita é repassada, mesmo sem melhora do valor bruto: o ajuste
+            // pode torná-la a melhor viável
+            if (aoMelhorar) {
+                aoMelhorar(melhorSolucao);
+            }
         } else {
-            std::lock_guard<std::mutex> lock(melhorSolucaoMutex);
             lambda = calcularValorObjetivo(deposito, backlog, melhorSolucao);
         }
     }
     
+    {
+        std::lock_guard<std::mutex> lock(mutexRodada);
+        encerrar = true;
+    }
+    inicioRodada.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    if (iteracoesExecutadas) *iteracoesExecutadas = iteracoes;
     return melhorSolucao;
 }
 
@@ -375,114 +831,102 @@ double calcularValorObjetivo(const Deposito& deposito, const Backlog& backlog, c
     return totalUnidades / solucao.corredoresWave.size();
 }
 
-void salvarSolucao(const std::string& diretorioSaida, const std::string& nomeArquivo, const Solucao& solucao) {
-    std::string nomeArquivoSemExtensao = nomeArquivo.substr(0, nomeArquivo.find_last_of("."));
-    std::string arquivoSaida = diretorioSaida + "/" + nomeArquivoSemExtensao + ".sol";
-    std::ofstream arquivo(arquivoSaida);
+std::string formatarSolucao(const Solucao& solucao) {
+    std::string saida;
+    saida.reserve(8 * (solucao.pedidosWave.size() + solucao.corredoresWave.size() + 2));
+    auto escreverLinha = [&saida](size_t valor) {
+        saida += std::to_string(valor);
+        saida += '\n';
+    };
 
-    if (arquivo.is_open()) {
-        // Salvar número de pedidos na wave
-        arquivo << solucao.pedidosWave.size() << std::endl;
+    // Número de pedidos e IDs dos pedidos na wave
+    escreverLinha(solucao.pedidosWave.size());
+    for (int pedidoId : solucao.pedidosWave) {
+        escreverLinha(static_cast<size_t>(pedidoId));
+    }
 
-        // Salvar IDs dos pedidos na wave
-        for (int pedidoId : solucao.pedidosWave) {
-            arquivo << pedidoId << std::endl;
-        }
+    // Número de corredores e IDs dos corredores visitados
+    escreverLinha(solucao.corredoresWave.size());
+    for (int corredorId : solucao.corredoresWave) {
+        escreverLinha(static_cast<size_t>(corredorId));
+    }
+    return saida;
+}
 
-        // Salvar número de corredores visitados
-        arquivo << solucao.corredoresWave.size() << std::endl;
+bool salvarSolucao(const std::string& diretorioSaida, const std::string& nomeArquivo, const Solucao& solucao) {
+    INSTRUMENTAR_FASE(FASE_ESCRITA);
+    std::string nomeArquivoSemExtensao = nomeArquivo.substr(0, nomeArquivo.find_last_of("."));
+    std::string arquivoSaida = diretorioSaida + "/" + nomeArquivoSemExtensao + ".sol";
+    std::string arquivoTemporario = arquivoSaida + ".tmp";
+    std::string conteudo = formatarSolucao(solucao);
 
-        // Salvar IDs dos corredores visitados
-        for (int corredorId : solucao.corredoresWave) {
-            arquivo << corredorId << std::endl;
+    {
+        std::ofstream arquivo(arquivoTemporario, std::ios::binary | std::ios::trunc);
+        if (!arquivo.is_open() || !arquivo.write(conteudo.data(), static_cast<std::streamsize>(conteudo.size()))) {
+            std::cerr << ("Erro ao salvar o arquivo: " + arquivoSaida + "\n");
+            return false;
         }
+    }
 
-        arquivo.close();
-        std::cout << "Solução salva em: " << arquivoSaida << std::endl;
-    } else {
-        std::cerr << "Erro ao salvar o arquivo: " << arquivoSaida << std::endl;
+    std::error_code erro;
+    std::filesystem::rename(arquivoTemporario, arquivoSaida, erro);
+    if (erro) {
+        std::filesystem::remove(arquivoTemporario, erro);
+        std::cerr << ("Erro ao salvar o arquivo: " + arquivoSaida + "\n");
+        return false;
     }
+    // Uma única escrita por mensagem: o estágio de escrita chama esta função sem o mutex de saída
+    std::cout << ("Solução salva em: " + arquivoSaida + "\n");
+    return true;
 }
 
 Solucao ajustarSolucao(const Deposito& deposito, const Backlog& backlog, Solucao solucao,
                       const LocalizadorItens& localizador, 
-                      const VerificadorDisponibilidade& verificador) {
-    // Inicializar o estoque disponível baseado nos corredores selecionados
-    std::unordered_map<int, int> estoqueDisponivel;
-    for (int corredorId : solucao.corredoresWave) {
-        for (const auto& [itemId, quantidade] : deposito.corredor[corredorId]) {
-            estoqueDisponivel[itemId] += quantidade;
-        }
-    }
-
-    // Identificar pedidos com estoque insuficiente
+                      const VerificadorDisponibilidade& verificador,
+                      const AnalisadorRelevancia& analisador,
+                      unsigned int numThreads) {
+    INSTRUMENTAR_FASE(FASE_AJUSTE);
+    // O oráculo acompanha a demanda da wave e a oferta dos corredores abertos por item
+    OraculoViabilidade oraculo(deposito, backlog);
+
+    // Identificar pedidos cuja demanda acumulada excede o estoque total do depósito
     std::vector<int> pedidosParaRemover;
     for (int pedidoId : solucao.pedidosWave) {
-        bool estoqueInsuficiente = false;
-        for (const auto& [itemId, quantidadeSolicitada] : backlog.pedido[pedidoId]) {
-            if (estoqueDisponivel[itemId] < quantidadeSolicitada) {
-                estoqueInsuficiente = true;
-                break;
-            }
-        }
-        
-        if (estoqueInsuficiente) {
-            pedidosParaRemover.push_back(pedidoId);
+        if (oraculo.cabeNoEstoque(pedidoId, verificador.estoqueTotal)) {
+            oraculo.adicionarPedido(pedidoId);
         } else {
-            // Deduzir o estoque para os pedidos que serão mantidos
-            for (const auto& [itemId, quantidadeSolicitada] : backlog.pedido[pedidoId]) {
-                estoqueDisponivel[itemId] -= quantidadeSolicitada;
-            }
+            pedidosParaRemover.push_back(pedidoId);
         }
     }
 
     // Remover os pedidos com estoque insuficiente
     for (int pedidoId : pedidosParaRemover) {
-        solucao.pedidosWave.erase(
-            std::remove(solucao.pedidosWave.begin(), solucao.pedidosWave.end(), pedidoId),
-            solucao.pedidosWave.end());
+        solucao.pedidosWave.remover(pedidoId);
     }
 
     // Recalcular o número total de unidades na wave
     int totalUnidades = 0;
     for (int pedidoId : solucao.pedidosWave) {
-        for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
-            totalUnidades += quantidade;
-        }
+        totalUnidades += analisador.numUnidades[pedidoId];
     }
 
     // Se o total de unidades for inferior a LB, adicionar mais pedidos até atingir LB
     if (totalUnidades < backlog.wave.LB) {
         // Usar o AnalisadorRelevancia para obter pedidos ordenados por relevância
-        AnalisadorRelevancia analisador(backlog.numPedidos);
-        analisador.construir(backlog, localizador);
-        std::vector<int> pedidosOrdenados = analisador.getPedidosOrdenadosPorRelevancia();
+        const std::vector<int>& pedidosOrdenados = analisador.getPedidosOrdenadosPorRelevancia();
         
         for (int pedidoId : pedidosOrdenados) {
-            // Pular pedidos que já estão na wave
-            if (std::find(solucao.pedidosWave.begin(), solucao.pedidosWave.end(), pedidoId) 
-                != solucao.pedidosWave.end()) {
+            // Pular pedidos que já estão na wave ou que ultrapassariam UB
+            if (solucao.pedidosWave.contem(pedidoId) ||
+                totalUnidades + analisador.numUnidades[pedidoId] > backlog.wave.UB) {
                 continue;
             }
             
-            // Verificar se o pedido pode ser atendido com o estoque disponível
-            bool estoqueInsuficiente = false;
-            for (const auto& [itemId, quantidadeSolicitada] : backlog.pedido[pedidoId]) {
-                if (estoqueDisponivel[itemId] < quantidadeSolicitada) {
-                    estoqueInsuficiente = true;
-                    break;
-                }
-            }
-            
-            if (!estoqueInsuficiente) {
-                int unidadesPedido = 0;
-                for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
-                    unidadesPedido += quantidade;
-                    estoqueDisponivel[itemId] -= quantidade;
-                }
-                
-                solucao.pedidosWave.push_back(pedidoId);
-                totalUnidades += unidadesPedido;
+            // Verificar se o pedido pode ser atendido com o estoque do depósito
+            if (oraculo.cabeNoEstoque(pedidoId, verificador.estoqueTotal)) {
+                oraculo.adicionarPedido(pedidoId);
+                solucao.pedidosWave.inserir(pedidoId);
+                totalUnidades += analisador.numUnidades[pedidoId];
                 
                 if (totalUnidades >= backlog.wave.LB) {
                     break;
@@ -493,27 +937,20 @@ Solucao ajustarSolucao(const Deposito& deposito, const Backlog& backlog, Solucao
     // Se o total de unidades for superior a UB, remover pedidos até atingir UB
     else if (totalUnidades > backlog.wave.UB) {
         // Ordenar pedidos pelo inverso da pontuação de relevância (menos relevantes primeiro)
-        AnalisadorRelevancia analisador(backlog.numPedidos);
-        analisador.construir(backlog, localizador);
-        
-        std::vector<int> pedidosNaWave = solucao.pedidosWave;
+        std::vector<int> pedidosNaWave = solucao.pedidosWave.ids();
         std::sort(pedidosNaWave.begin(), pedidosNaWave.end(),
             [&analisador](int a, int b) {
-                return analisador.infoPedidos[a].pontuacaoRelevancia < 
-                       analisador.infoPedidos[b].pontuacaoRelevancia;
+                return analisador.pontuacaoRelevancia[a] < 
+                       analisador.pontuacaoRelevancia[b];
             });
         
         // Remover pedidos menos relevantes até atingir UB
         for (int pedidoId : pedidosNaWave) {
-            int unidadesPedido = 0;
-            for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
-                unidadesPedido += quantidade;
-            }
+            int unidadesPedido = analisador.numUnidades[pedidoId];
             
             if (totalUnidades - unidadesPedido >= backlog.wave.LB) {
-                solucao.pedidosWave.erase(
-                    std::remove(solucao.pedidosWave.begin(), solucao.pedidosWave.end(), pedidoId),
-                    solucao.pedidosWave.end());
+                oraculo.removerPedido(pedidoId);
+                solucao.pedidosWave.remover(pedidoId);
                 totalUnidades -= unidadesPedido;
                 
                 if (totalUnidades <= backlog.wave.UB) {
@@ -523,32 +960,35 @@ Solucao ajustarSolucao(const Deposito& deposito, const Backlog& backlog, Solucao
         }
     }
 
-    // Recalcular os corredores necessários usando o LocalizadorItens
-    std::unordered_set<int> corredoresNecessarios;
-    for (int pedidoId : solucao.pedidosWave) {
-        for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
-            const auto& corredoresComItem = localizador.getCorredoresComItem(itemId);
-            
-            int quantidadeRestante = quantidade;
-            
-            // Ordenar corredores por quantidade disponível
-            std::vector<std::pair<int, int>> corredoresOrdenados(
-                corredoresComItem.begin(), corredoresComItem.end());
-            std::sort(corredoresOrdenados.begin(), corredoresOrdenados.end(),
-                [](const auto& a, const auto& b) { return a.second > b.second; });
-            
-            for (const auto& [corredorId, quantidadeDisponivel] : corredoresOrdenados) {
-                if (quantidadeRestante <= 0) break;
-                
-                corredoresNecessarios.insert(corredorId);
-                quantidadeRestante -= std::min(quantidadeRestante, quantidadeDisponivel);
+    // Partir da cobertura gulosa, abrir os corredores que faltarem e fechar os redundantes
+    SeletorCorredores seletorCorredores(localizador);
+    for (int corredorId : seletorCorredores.selecionar(backlog, solucao.pedidosWave)) {
+        oraculo.abrirCorredor(corredorId);
+    }
+    oraculo.completarCorredores(localizador);
+    oraculo.reduzirCorredores();
+    solucao.corredoresWave = oraculo.getCorredoresAbertos();
+
+    // Incluir pedidos atendidos pelos corredores já abertos: aumentam as unidades sem novos corredores
+    if (oraculo.viavel() && totalUnidades < backlog.wave.UB && !solucao.corredoresWave.empty()) {
+        std::vector<int> estoqueAberto = verificador.calcularEstoque(deposito, solucao.corredoresWave);
+        std::vector<uint64_t> candidatos = verificador.verificarLote(estoqueAberto, numThreads);
+        
+        for (int pedidoId : analisador.getPedidosOrdenadosPorRelevancia()) {
+            if (!((candidatos[pedidoId >> 6] >> (pedidoId & 63)) & 1ULL) ||
+                solucao.pedidosWave.contem(pedidoId) ||
+                totalUnidades + analisador.numUnidades[pedidoId] > backlog.wave.UB ||
+                !oraculo.cabeNaOferta(pedidoId)) {
+                continue;
             }
+            oraculo.adicionarPedido(pedidoId);
+            solucao.pedidosWave.inserir(pedidoId);
+            totalUnidades += analisador.numUnidades[pedidoId];
         }
     }
-    solucao.corredoresWave.assign(corredoresNecessarios.begin(), corredoresNecessarios.end());
 
     // Recalcular o valor objetivo
     solucao.valorObjetivo = calcularValorObjetivo(deposito, backlog, solucao);
 
     return solucao;
-}
\ No newline at end of file
+}
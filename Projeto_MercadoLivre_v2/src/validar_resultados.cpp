@@ -8,28 +8,22 @@
 #include <unordered_map>  // Adicionando este cabeçalho faltante
 #include <filesystem>     // Adicionando este cabeçalho faltante
 #include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
 
-/**
- * @brief Estrutura para armazenar os dados de um arquivo de solução
- */
-struct SolucaoValidacao {
-    std::vector<int> pedidosWave;
-    std::vector<int> corredoresWave;
-};
-
-/**
- * @brief Lê um arquivo de solução e retorna os dados
- * @param arquivoSolucao Caminho para o arquivo de solução
- * @return SolucaoValidacao Estrutura com os dados do arquivo de solução
- */
 SolucaoValidacao lerArquivoSolucao(const std::string& arquivoSolucao) {
-    SolucaoValidacao solucao;
     std::ifstream file(arquivoSolucao);
-    std::string linha;
-
     if (!file.is_open()) {
         throw std::runtime_error("Não foi possível abrir o arquivo de solução: " + arquivoSolucao);
     }
+    return lerSolucao(file);
+}
+
+SolucaoValidacao lerSolucao(std::istream& file) {
+    SolucaoValidacao solucao;
+    std::string linha;
 
     // Ler número de pedidos na wave
     int numPedidos;
@@ -81,105 +75,226 @@ SolucaoValidacao lerArquivoSolucao(const std::string& arquivoSolucao) {
         }
     }
 
-    file.close();
     return solucao;
 }
 
-/**
- * @brief Valida as restrições do problema para uma dada solução e retorna um relatório detalhado
- * @param deposito Dados do depósito
- * @param backlog Dados do backlog
- * @param solucaoValidacao Dados do arquivo de solução
- * @param logFile Referência para o arquivo de log
- * @return bool True se todas as restrições forem atendidas, false caso contrário
- */
-bool validarRestricoes(const Deposito& deposito, const Backlog& backlog, const SolucaoValidacao& solucaoValidacao, std::ofstream& logFile) {
-    bool validacaoAprovada = true;
-
-    // 1. Validação dos IDs dos pedidos
-    logFile << "  1. Validação dos IDs dos pedidos: ";
-    bool pedidosValidos = true;
-    for (int pedidoId : solucaoValidacao.pedidosWave) {
+namespace {
+
+inline bool testarEMarcar(std::vector<uint64_t>& mapa, int id) {
+    uint64_t bit = uint64_t{1} << (id & 63);
+    bool marcado = (mapa[id >> 6] & bit) != 0;
+    mapa[id >> 6] |= bit;
+    return marcado;
+}
+
+void escreverTextoJson(std::ostream& saida, const std::string& texto) {
+    saida << '"';
+    for (char c : texto) {
+        switch (c) {
+            case '"':  saida << "\\\""; break;
+            case '\\': saida << "\\\\"; break;
+            case '\n': saida << "\\n"; break;
+            case '\t': saida << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    saida << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c)
+                          << std::dec << std::setfill(' ');
+                } else {
+                    saida << c;
+                }
+        }
+    }
+    saida << '"';
+}
+
+} // namespace
+
+RelatorioValidacao validarSolucao(const Instancia& instancia, const SolucaoValidacao& solucao) {
+    const Deposito& deposito = instancia.getDeposito();
+    const Backlog& backlog = instancia.getBacklog();
+    const VerificadorDisponibilidade& verificador = instancia.getVerificador();
+
+    RelatorioValidacao relatorio;
+    relatorio.numPedidos = static_cast<int>(solucao.pedidosWave.size());
+    relatorio.numCorredores = static_cast<int>(solucao.corredoresWave.size());
+    relatorio.LB = backlog.wave.LB;
+    relatorio.UB = backlog.wave.UB;
+
+    // 1 e 2. IDs no intervalo e sem repetições (mapas de bits de pedidos e corredores)
+    std::vector<uint64_t> pedidosVistos((backlog.numPedidos + 63) / 64, 0);
+    std::vector<uint64_t> corredoresVistos((deposito.numCorredores + 63) / 64, 0);
+    relatorio.idsPedidosValidos = true;
+    relatorio.semRepeticoes = true;
+    for (int pedidoId : solucao.pedidosWave) {
         if (pedidoId < 0 || pedidoId >= backlog.numPedidos) {
-            logFile << "Reprovada\n";
-            logFile << "     Erro: ID de pedido inválido: " << pedidoId << " (intervalo válido: 0-" << backlog.numPedidos - 1 << ")\n";
-            validacaoAprovada = false;
-            pedidosValidos = false;
+            relatorio.idsPedidosValidos = false;
+            relatorio.idInvalido = pedidoId;
             break;
         }
+        if (testarEMarcar(pedidosVistos, pedidoId)) relatorio.semRepeticoes = false;
     }
-    if (pedidosValidos) {
-        logFile << "Aprovada\n";
-    }
-
-    // 2. Validação dos IDs dos corredores
-    logFile << "  2. Validação dos IDs dos corredores: ";
-    bool corredoresValidos = true;
-    for (int corredorId : solucaoValidacao.corredoresWave) {
+    relatorio.idsCorredoresValidos = true;
+    for (int corredorId : solucao.corredoresWave) {
         if (corredorId < 0 || corredorId >= deposito.numCorredores) {
-            logFile << "Reprovada\n";
-            logFile << "     Erro: ID de corredor inválido: " << corredorId << " (intervalo válido: 0-" << deposito.numCorredores - 1 << ")\n";
-            validacaoAprovada = false;
-            corredoresValidos = false;
+            relatorio.idsCorredoresValidos = false;
+            if (relatorio.idInvalido < 0) relatorio.idInvalido = corredorId;
             break;
         }
+        if (testarEMarcar(corredoresVistos, corredorId)) relatorio.semRepeticoes = false;
     }
-    if (corredoresValidos) {
-        logFile << "Aprovada\n";
+    if (!relatorio.idsPedidosValidos || !relatorio.idsCorredoresValidos) {
+        return relatorio;
     }
 
-    // 3. Validação do número total de unidades na wave
-    logFile << "  3. Validação do número total de unidades na wave: ";
-    int totalUnidades = 0;
-    for (int pedidoId : solucaoValidacao.pedidosWave) {
-        for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
-            totalUnidades += quantidade;
+    // 3. Unidades e demanda por item, percorrendo o CSR do backlog
+    std::vector<int> demanda(deposito.numItens, 0);
+    for (int pedidoId : solucao.pedidosWave) {
+        for (int k = verificador.inicioPedido[pedidoId]; k < verificador.inicioPedido[pedidoId + 1]; k++) {
+            demanda[verificador.itemPedido[k]] += verificador.quantidadePedido[k];
+            relatorio.totalUnidades += verificador.quantidadePedido[k];
         }
     }
-    logFile << "Total de unidades na wave: " << totalUnidades << ", Limites LB e UB: " << backlog.wave.LB << " - " << backlog.wave.UB << ": ";
+    relatorio.unidadesNosLimites = relatorio.totalUnidades >= backlog.wave.LB &&
+                                   relatorio.totalUnidades <= backlog.wave.UB;
 
-    bool unidadesValidas = true;
-    if (totalUnidades < backlog.wave.LB || totalUnidades > backlog.wave.UB) {
-        logFile << "Reprovada\n";
-        logFile << "     Erro: Número total de unidades (" << totalUnidades << ") fora dos limites LB e UB (" <<
-                   backlog.wave.LB << " - " << backlog.wave.UB << ")\n";
-        validacaoAprovada = false;
-        unidadesValidas = false;
+    // 4. Demanda total contra o estoque dos corredores visitados
+    std::vector<int> estoque = verificador.calcularEstoque(deposito, solucao.corredoresWave);
+    relatorio.estoqueSuficiente = true;
+    for (int itemId = 0; itemId < deposito.numItens; itemId++) {
+        if (demanda[itemId] > estoque[itemId]) {
+            relatorio.estoqueSuficiente = false;
+            relatorio.itemSemEstoque = itemId;
+            relatorio.demandaItem = demanda[itemId];
+            relatorio.estoqueItem = estoque[itemId];
+            break;
+        }
     }
-    if (unidadesValidas) {
-        logFile << "Aprovada\n";
+
+    if (!solucao.corredoresWave.empty()) {
+        relatorio.valorObjetivo = static_cast<double>(relatorio.totalUnidades) / solucao.corredoresWave.size();
     }
+    relatorio.valida = relatorio.semRepeticoes && relatorio.unidadesNosLimites && relatorio.estoqueSuficiente;
+    return relatorio;
+}
 
-    // 4. Validação de estoque suficiente
-    logFile << "  4. Validação de estoque suficiente: ";
-    std::unordered_map<int, int> estoqueDisponivel;
-    for (int corredorId : solucaoValidacao.corredoresWave) {
-        for (const auto& [itemId, quantidade] : deposito.corredor[corredorId]) {
-            estoqueDisponivel[itemId] += quantidade;
+std::vector<RelatorioValidacao> validarLote(const std::string& diretorioEntrada, const std::string& diretorioSaida,
+                                            CacheInstancias& cache, unsigned int numThreads) {
+    std::vector<std::filesystem::path> arquivos;
+    for (const auto& entry : std::filesystem::directory_iterator(diretorioEntrada)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".txt") {
+            arquivos.push_back(entry.path());
         }
     }
+    std::sort(arquivos.begin(), arquivos.end());
 
-    bool estoqueSuficiente = true;
-    for (int pedidoId : solucaoValidacao.pedidosWave) {
-        for (const auto& [itemId, quantidadeSolicitada] : backlog.pedido[pedidoId]) {
-            if (estoqueDisponivel[itemId] < quantidadeSolicitada) {
-                logFile << "Reprovada\n";
-                logFile << "     Erro: Estoque insuficiente para o item " << itemId << " no pedido " << pedidoId << "\n";
-                logFile << "       Quantidade solicitada: " << quantidadeSolicitada << "\n";
-                logFile << "       Estoque disponível: " << estoqueDisponivel[itemId] << "\n";
-                validacaoAprovada = false;
-                estoqueSuficiente = false;
-                break;
+    if (numThreads == 0) numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 4;
+    numThreads = std::max(1u, std::min(numThreads, static_cast<unsigned int>(arquivos.size())));
+
+    // Cada thread pega o próximo arquivo livre (instâncias grandes não travam as demais)
+    std::vector<RelatorioValidacao> relatorios(arquivos.size());
+    std::atomic<size_t> proximo{0};
+    auto trabalhar = [&]() {
+        for (size_t i = proximo++; i < arquivos.size(); i = proximo++) {
+            auto inicio = std::chrono::steady_clock::now();
+            std::string arquivoSolucao = diretorioSaida + "/" + arquivos[i].stem().string() + ".sol";
+            RelatorioValidacao relatorio;
+            try {
+                InstanciaPtr instancia = cache.obter(arquivos[i].string()).instancia;
+                relatorio = validarSolucao(*instancia, lerArquivoSolucao(arquivoSolucao));
+            } catch (const std::exception& e) {
+                relatorio.erro = e.what();
             }
+            relatorio.instancia = arquivos[i].stem().string();
+            relatorio.arquivoSolucao = arquivoSolucao;
+            relatorio.tempoMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
+            relatorios[i] = std::move(relatorio);
         }
-        if (!estoqueSuficiente) break;
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 1; t < numThreads; t++) {
+        threads.emplace_back(trabalhar);
     }
+    trabalhar();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return relatorios;
+}
 
-    if (estoqueSuficiente) {
-        logFile << "Aprovada\n";
+void escreverRelatorioTexto(const RelatorioValidacao& relatorio, std::ostream& saida) {
+    saida << "Instância: " << relatorio.instancia << "\n";
+    saida << "Arquivo de solução: " << relatorio.arquivoSolucao << "\n";
+    if (!relatorio.erro.empty()) {
+        saida << "Erro ao validar: " << relatorio.erro << "\n";
+        return;
+    }
+
+    saida << "  1. Validação dos IDs dos pedidos: " << (relatorio.idsPedidosValidos ? "Aprovada" : "Reprovada") << "\n";
+    if (!relatorio.idsPedidosValidos) {
+        saida << "     Erro: ID de pedido inválido: " << relatorio.idInvalido << "\n";
+    }
+    saida << "  2. Validação dos IDs dos corredores: " << (relatorio.idsCorredoresValidos ? "Aprovada" : "Reprovada") << "\n";
+    if (!relatorio.idsCorredoresValidos) {
+        saida << "     Erro: ID de corredor inválido: " << relatorio.idInvalido << "\n";
     }
+    if (relatorio.idsPedidosValidos && relatorio.idsCorredoresValidos) {
+        if (!relatorio.semRepeticoes) {
+            saida << "     Erro: pedidos ou corredores repetidos na solução\n";
+        }
+        saida << "  3. Validação do número total de unidades na wave: Total de unidades na wave: "
+              << relatorio.totalUnidades << ", Limites LB e UB: " << relatorio.LB << " - " << relatorio.UB << ": "
+              << (relatorio.unidadesNosLimites ? "Aprovada" : "Reprovada") << "\n";
+        saida << "  4. Validação de estoque suficiente: " << (relatorio.estoqueSuficiente ? "Aprovada" : "Reprovada") << "\n";
+        if (!relatorio.estoqueSuficiente) {
+            saida << "     Erro: Estoque insuficiente para o item " << relatorio.itemSemEstoque << "\n";
+            saida << "       Quantidade solicitada: " << relatorio.demandaItem << "\n";
+            saida << "       Estoque disponível: " << relatorio.estoqueItem << "\n";
+        }
+        saida << "  Valor objetivo: " << relatorio.valorObjetivo << "\n";
+    }
+    saida << "Validação: " << (relatorio.valida ? "Aprovada" : "Reprovada") << "\n";
+}
 
-    return validacaoAprovada;
+void escreverRelatorioJson(const std::vector<RelatorioValidacao>& relatorios, std::ostream& saida) {
+    int aprovadas = 0;
+    double somaObjetivos = 0.0;
+    saida << "{\n  \"instancias\": [";
+    for (size_t i = 0; i < relatorios.size(); i++) {
+        const RelatorioValidacao& r = relatorios[i];
+        aprovadas += r.valida ? 1 : 0;
+        somaObjetivos += r.valida ? r.valorObjetivo : 0.0;
+
+        saida << (i ? ",\n    {" : "\n    {");
+        saida << "\"instancia\": ";
+        escreverTextoJson(saida, r.instancia);
+        saida << ", \"solucao\": ";
+        escreverTextoJson(saida, r.arquivoSolucao);
+        saida << ", \"valida\": " << (r.valida ? "true" : "false");
+        if (!r.erro.empty()) {
+            saida << ", \"erro\": ";
+            escreverTextoJson(saida, r.erro);
+        } else {
+            saida << ", \"idsPedidos\": " << (r.idsPedidosValidos ? "true" : "false")
+                  << ", \"idsCorredores\": " << (r.idsCorredoresValidos ? "true" : "false")
+                  << ", \"semRepeticoes\": " << (r.semRepeticoes ? "true" : "false")
+                  << ", \"unidadesNosLimites\": " << (r.unidadesNosLimites ? "true" : "false")
+                  << ", \"estoqueSuficiente\": " << (r.estoqueSuficiente ? "true" : "false")
+                  << ", \"pedidos\": " << r.numPedidos
+                  << ", \"corredores\": " << r.numCorredores
+                  << ", \"unidades\": " << r.totalUnidades
+                  << ", \"LB\": " << r.LB << ", \"UB\": " << r.UB
+                  << ", \"objetivo\": " << r.valorObjetivo;
+            if (r.itemSemEstoque >= 0) {
+                saida << ", \"itemSemEstoque\": " << r.itemSemEstoque
+                      << ", \"demanda\": " << r.demandaItem << ", \"estoque\": " << r.estoqueItem;
+            }
+        }
+        saida << ", \"tempoMs\": " << r.tempoMs << "}";
+    }
+    saida << "\n  ],\n  \"total\": " << relatorios.size() << ",\n  \"aprovadas\": " << aprovadas
+          << ",\n  \"somaObjetivos\": " << somaObjetivos << "\n}\n";
 }
 
 void validarResultados(const std::string& diretorioEntrada, const std::string& diretorioSaida, const std::string& arquivoLog) {
@@ -189,43 +304,27 @@ void validarResultados(const std::string& diretorioEntrada, const std::string& d
         return;
     }
 
-    logFile << "=== Relatório de Validação dos Resultados ===\n\n";
-
-    // Iterar sobre os arquivos de entrada
-    for (const auto& entry : std::filesystem::directory_iterator(diretorioEntrada)) {
-        if (entry.is_regular_file()) {
-            std::string arquivoEntrada = entry.path().string();
-            std::string nomeArquivo = entry.path().filename().string();
-            std::string nomeArquivoSemExtensao = nomeArquivo.substr(0, nomeArquivo.find_last_of("."));
-            std::string arquivoSolucao = diretorioSaida + "/" + nomeArquivoSemExtensao + ".sol";
+    auto inicio = std::chrono::steady_clock::now();
+    CacheInstancias cache;
+    std::vector<RelatorioValidacao> relatorios = validarLote(diretorioEntrada, diretorioSaida, cache);
+    double tempoMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - inicio).count();
 
-            logFile << "Arquivo de entrada: " << arquivoEntrada << "\n";
-            logFile << "Arquivo de solução: " << arquivoSolucao << "\n";
-
-            try {
-                // Carregar a instância
-                InputParser parser;
-                auto [deposito, backlog] = parser.parseFile(arquivoEntrada);
-
-                // Ler o arquivo de solução
-                SolucaoValidacao solucaoValidacao = lerArquivoSolucao(arquivoSolucao);
-
-                // Validar as restrições
-                bool validacaoAprovada = validarRestricoes(deposito, backlog, solucaoValidacao, logFile);
-
-                if (validacaoAprovada) {
-                    logFile << "Validação: Aprovada\n";
-                } else {
-                    logFile << "Validação: Reprovada\n";
-                }
-            } catch (const std::exception& e) {
-                logFile << "Erro ao validar: " << e.what() << "\n";
-            }
+    logFile << "=== Relatório de Validação dos Resultados ===\n\n";
+    int aprovadas = 0;
+    for (const auto& relatorio : relatorios) {
+        escreverRelatorioTexto(relatorio, logFile);
+        logFile << "----------------------------------------\n";
+        aprovadas += relatorio.valida ? 1 : 0;
+    }
+    logFile.close();
 
-            logFile << "----------------------------------------\n";
-        }
+    std::string arquivoJson = std::filesystem::path(arquivoLog).replace_extension(".json").string();
+    std::ofstream json(arquivoJson);
+    if (json.is_open()) {
+        escreverRelatorioJson(relatorios, json);
     }
 
-    logFile.close();
-    std::cout << "Relatório de validação salvo em: " << arquivoLog << std::endl;
-}
\ No newline at end of file
+    std::cout << "Validação: " << aprovadas << " de " << relatorios.size() << " soluções aprovadas em "
+              << tempoMs << " ms\n";
+    std::cout << "Relatório de validação salvo em: " << arquivoLog << " e " << arquivoJson << std::endl;
+}
@@ -1,4 +1,48 @@
 #include "verificador_disponibilidade.h"
+#include <algorithm>
+#include <thread>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace {
+
+// Número mínimo de pedidos por thread (múltiplo de 64 para que cada thread escreva palavras próprias).
+// Abaixo disso criar a thread custa mais que verificar o bloco, e o lote roda na thread chamadora
+constexpr int PEDIDOS_POR_THREAD = 64 * 256;
+
+/**
+ * @brief Marca no mapa de bits os pedidos com alguma posição em [inicio, fim) acima do estoque
+ */
+void marcarViolacoes(const VerificadorDisponibilidade& v, const std::vector<int>& estoque,
+                     int inicio, int fim, std::vector<uint64_t>& atendiveis) {
+    const int* itens = v.itemPedido.data();
+    const int* quantidades = v.quantidadePedido.data();
+    int k = inicio;
+    
+#if defined(__AVX2__)
+    // Gather do estoque de 8 posições por vez; o caminho escalar só trata as violações
+    for (; k + 8 <= fim; k += 8) {
+        __m256i indices = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(itens + k));
+        __m256i pedida = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(quantidades + k));
+        __m256i disponivel = _mm256_i32gather_epi32(estoque.data(), indices, 4);
+        int mascara = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pedida, disponivel)));
+        while (mascara) {
+            int pedidoId = v.pedidoDaEntrada[k + __builtin_ctz(mascara)];
+            atendiveis[pedidoId >> 6] &= ~(1ULL << (pedidoId & 63));
+            mascara &= mascara - 1;
+        }
+    }
+#endif
+    for (; k < fim; k++) {
+        if (quantidades[k] > estoque[itens[k]]) {
+            int pedidoId = v.pedidoDaEntrada[k];
+            atendiveis[pedidoId >> 6] &= ~(1ULL << (pedidoId & 63));
+        }
+    }
+}
+
+} // namespace
 
 void VerificadorDisponibilidade::construir(const Deposito& deposito) {
     for (int corredorId = 0; corredorId < deposito.numCorredores; corredorId++) {
@@ -8,6 +52,73 @@ void VerificadorDisponibilidade::construir(const Deposito& deposito) {
     }
 }
 
+void VerificadorDisponibilidade::indexarPedidos(const Backlog& backlog, unsigned int numThreads) {
+    inicioPedido.assign(backlog.numPedidos + 1, 0);
+    itemPedido.clear();
+    quantidadePedido.clear();
+    pedidoDaEntrada.clear();
+    
+    for (int pedidoId = 0; pedidoId < backlog.numPedidos; pedidoId++) {
+        for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
+            itemPedido.push_back(itemId);
+            quantidadePedido.push_back(quantidade);
+            pedidoDaEntrada.push_back(pedidoId);
+        }
+        inicioPedido[pedidoId + 1] = static_cast<int>(itemPedido.size());
+    }
+    
+    pedidosAtivos.assign((backlog.numPedidos + 63) / 64, ~0ULL);
+    if (backlog.numPedidos % 64 != 0) {
+        pedidosAtivos.back() = (1ULL << (backlog.numPedidos % 64)) - 1;
+    }
+    for (int pedidoId = 0; pedidoId < backlog.numPedidos; pedidoId++) {
+        // Pedidos vazios (por exemplo, cancelados) não são atendíveis
+        if (inicioPedido[pedidoId + 1] == inicioPedido[pedidoId]) {
+            pedidosAtivos[pedidoId >> 6] &= ~(1ULL << (pedidoId & 63));
+        }
+    }
+    pedidosAtendiveis = verificarLote(estoqueTotal, numThreads);
+}
+
+int VerificadorDisponibilidade::adicionarPedido(const std::map<int, int>& pedido) {
+    const int pedidoId = static_cast<int>(inicioPedido.size()) - 1;
+    if ((pedidoId & 63) == 0) {
+        pedidosAtivos.push_back(0);
+        pedidosAtendiveis.push_back(0);
+    }
+    
+    bool atendivel = true;
+    for (const auto& [itemId, quantidade] : pedido) {
+        itemPedido.push_back(itemId);
+        quantidadePedido.push_back(quantidade);
+        pedidoDaEntrada.push_back(pedidoId);
+        atendivel = atendivel && quantidade <= estoqueTotal[itemId];
+    }
+    inicioPedido.push_back(static_cast<int>(itemPedido.size()));
+    
+    if (!pedido.empty()) {
+        pedidosAtivos[pedidoId >> 6] |= 1ULL << (pedidoId & 63);
+        if (atendivel) {
+            pedidosAtendiveis[pedidoId >> 6] |= 1ULL << (pedidoId & 63);
+        }
+    }
+    return pedidoId;
+}
+
+void VerificadorDisponibilidade::removerPedido(int pedidoId) {
+    pedidosAtivos[pedidoId >> 6] &= ~(1ULL << (pedidoId & 63));
+    pedidosAtendiveis[pedidoId >> 6] &= ~(1ULL << (pedidoId & 63));
+}
+
+void VerificadorDisponibilidade::reverificarPedidos(const std::vector<int>& pedidos) {
+    std::vector<uint64_t> atendiveis = verificarLote(pedidos, estoqueTotal);
+    for (int pedidoId : pedidos) {
+        uint64_t bit = 1ULL << (pedidoId & 63);
+        pedidosAtendiveis[pedidoId >> 6] = (pedidosAtendiveis[pedidoId >> 6] & ~bit) | 
+                                           (atendiveis[pedidoId >> 6] & bit);
+    }
+}
+
 bool VerificadorDisponibilidade::verificarDisponibilidade(const std::map<int, int>& pedido) const {
     for (const auto& [itemId, quantidadeSolicitada] : pedido) {
         if (estoqueTotal[itemId] < quantidadeSolicitada) {
@@ -15,4 +126,66 @@ bool VerificadorDisponibilidade::verificarDisponibilidade(const std::map<int, in
         }
     }
     return true;
-}
\ No newline at end of file
+}
+
+std::vector<uint64_t> VerificadorDisponibilidade::verificarLote(const std::vector<int>& estoque,
+                                                                unsigned int numThreads) const {
+    const int numPedidos = static_cast<int>(inicioPedido.size()) - 1;
+    const int numPalavras = (numPedidos + 63) / 64;
+    
+    // Começar com todos os pedidos ativos e limpar os bits dos que violam o estoque
+    std::vector<uint64_t> atendiveis = pedidosAtivos;
+    atendiveis.resize(numPalavras, 0);
+    
+    if (numThreads == 0) numThreads = std::thread::hardware_concurrency();
+    if (numThreads == 0) numThreads = 4;
+    numThreads = std::max(1u, std::min(numThreads,
+        static_cast<unsigned int>((numPedidos + PEDIDOS_POR_THREAD - 1) / PEDIDOS_POR_THREAD)));
+    
+    if (numThreads == 1) {
+        marcarViolacoes(*this, estoque, 0, inicioPedido[numPedidos], atendiveis);
+        return atendiveis;
+    }
+    
+    // Blocos alinhados a 64 pedidos: cada thread escreve apenas as suas palavras
+    int pedidosPorThread = ((numPedidos + numThreads - 1) / numThreads + 63) / 64 * 64;
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < numThreads; t++) {
+        int primeiro = std::min(numPedidos, static_cast<int>(t) * pedidosPorThread);
+        int ultimo = std::min(numPedidos, primeiro + pedidosPorThread);
+        if (primeiro >= ultimo) break;
+        threads.emplace_back(marcarViolacoes, std::cref(*this), std::cref(estoque),
+                             inicioPedido[primeiro], inicioPedido[ultimo], std::ref(atendiveis));
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    
+    return atendiveis;
+}
+
+std::vector<uint64_t> VerificadorDisponibilidade::verificarLote(const std::vector<int>& pedidos,
+                                                                const std::vector<int>& estoque) const {
+    const int numPedidos = static_cast<int>(inicioPedido.size()) - 1;
+    std::vector<uint64_t> atendiveis((numPedidos + 63) / 64, 0);
+    
+    for (int pedidoId : pedidos) {
+        atendiveis[pedidoId >> 6] |= pedidosAtivos[pedidoId >> 6] & (1ULL << (pedidoId & 63));
+    }
+    for (int pedidoId : pedidos) {
+        marcarViolacoes(*this, estoque, inicioPedido[pedidoId], inicioPedido[pedidoId + 1], atendiveis);
+    }
+    
+    return atendiveis;
+}
+
+std::vector<int> VerificadorDisponibilidade::calcularEstoque(const Deposito& deposito,
+                                                             const std::vector<int>& corredores) const {
+    std::vector<int> estoque(estoqueTotal.size(), 0);
+    for (int corredorId : corredores) {
+        for (const auto& [itemId, quantidade] : deposito.corredor[corredorId]) {
+            estoque[itemId] += quantidade;
+        }
+    }
+    return estoque;
+}
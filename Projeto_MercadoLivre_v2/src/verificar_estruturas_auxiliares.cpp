@@ -1,7 +1,7 @@
 #include "verificar_estruturas_auxiliares.h"
 #include <iostream>
 #include <iomanip>
-#include "parser.h"
+#include "instancia.h"
 #include "armazem.h"
 #include "localizador_itens.h"
 #include "verificador_disponibilidade.h"
@@ -11,9 +11,10 @@
 void verificarEstruturasAuxiliares(const std::string& filePath) {
     std::cout << "Verificando estruturas auxiliares para a instância: " << filePath << std::endl;
     try {
-        // Carregar a instância
-        InputParser parser;
-        auto [deposito, backlog] = parser.parseFile(filePath);
+        // Carregar a instância compartilhada
+        InstanciaPtr instancia = Instancia::carregar(filePath);
+        const Deposito& deposito = instancia->getDeposito();
+        const Backlog& backlog = instancia->getBacklog();
         
         std::cout << "\n=== Informações Básicas da Instância ===\n";
         std::cout << "Número de pedidos: " << backlog.numPedidos << std::endl;
@@ -21,15 +22,10 @@ void verificarEstruturasAuxiliares(const std::string& filePath) {
         std::cout << "Número de corredores: " << deposito.numCorredores << std::endl;
         std::cout << "Limites da wave: LB=" << backlog.wave.LB << ", UB=" << backlog.wave.UB << std::endl;
         
-        // Inicializar estruturas auxiliares
-        LocalizadorItens localizador(deposito.numItens);
-        localizador.construir(deposito);
-        
-        VerificadorDisponibilidade verificador(deposito.numItens);
-        verificador.construir(deposito);
-        
-        AnalisadorRelevancia analisador(backlog.numPedidos);
-        analisador.construir(backlog, localizador);
+        // Obter estruturas auxiliares (construídas uma única vez pela instância)
+        const LocalizadorItens& localizador = instancia->getLocalizador();
+        const VerificadorDisponibilidade& verificador = instancia->getVerificador();
+        const AnalisadorRelevancia& analisador = instancia->getAnalisador();
         
         // Exibir informações do Localizador de Itens
         std::cout << "\n=== Localizador de Itens ===\n";
@@ -66,11 +62,11 @@ void verificarEstruturasAuxiliares(const std::string& filePath) {
         std::cout << std::setw(8) << "Pedido" << std::setw(10) << "Tipos" << std::setw(12) << "Unidades" 
                   << std::setw(12) << "Corredores" << std::setw(15) << "Pontuação" << std::endl;
         
-        auto pedidosOrdenados = analisador.getPedidosOrdenadosPorRelevancia();
+        auto pedidosOrdenados = analisador.getPedidosMaisRelevantes(10);
         int pedidosToShow = std::min(10, backlog.numPedidos);
         for (int i = 0; i < pedidosToShow; i++) {
             int pedidoId = pedidosOrdenados[i];
-            const auto& info = analisador.infoPedidos[pedidoId];
+            const auto info = analisador.getInfoPedido(pedidoId);
             std::cout << std::setw(8) << pedidoId 
                       << std::setw(10) << info.numItens 
                       << std::setw(12) << info.numUnidades 
@@ -84,7 +80,7 @@ void verificarEstruturasAuxiliares(const std::string& filePath) {
         
         // Selecionar e exibir a melhor wave
         std::cout << "\n=== Seleção de Wave Ótima ===\n";
-        GestorWaves gestor(deposito, backlog);
+        GestorWaves gestor(instancia);
         auto melhorWave = gestor.selecionarMelhorWave();
         
         std::cout << "Melhor wave encontrada:\n";
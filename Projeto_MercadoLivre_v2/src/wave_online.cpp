@@ -0,0 +1,270 @@
+#include "wave_online.h"
+#include "partida_quente.h"
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+
+// Pedidos copiados por vez ao tirar a cópia do backlog para a reotimização
+constexpr int PEDIDOS_POR_BLOCO_COPIA = 512;
+
+} // namespace
+
+WaveOnline::WaveOnline(const InstanciaPtr& instancia)
+    : base(instancia),
+      deposito(instancia->getDeposito()),
+      localizador(instancia->getLocalizador()),
+      backlog(instancia->getBacklog()),
+      verificador(instancia->getVerificador()),
+      analisador(backlog.numPedidos),
+      demanda(deposito.numItens, 0),
+      oferta(deposito.numItens, 0),
+      corredorAberto(deposito.numCorredores, 0) {
+    analisador.construir(backlog, localizador);
+    atualizarObjetivo();
+
+    Solucao inicial = resolverWave(deposito, backlog, localizador, instancia->getVerificador(),
+                                   instancia->getAnalisador(), instancia->getAgrupador());
+    publicar(inicial, backlog.numPedidos);
+
+    otimizador = std::thread(&WaveOnline::executarReotimizacao, this);
+}
+
+WaveOnline::~WaveOnline() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        parar = true;
+    }
+    condicao.notify_all();
+    otimizador.join();
+}
+
+int WaveOnline::incluirPedido(std::map<int, int> pedido) {
+    std::lock_guard<std::mutex> lock(mutex);
+    backlog.pedido.push_back(std::move(pedido));
+    backlog.numPedidos++;
+    int pedidoId = verificador.adicionarPedido(backlog.pedido.back());
+    analisador.adicionarPedido(backlog, localizador);
+
+    tentarIncluirNaWave(pedidoId, unidades < backlog.wave.LB);
+
+    pendente = true;
+    condicao.notify_all();
+    return pedidoId;
+}
+
+bool WaveOnline::cancelarPedido(int pedidoId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (pedidoId < 0 || pedidoId >= backlog.numPedidos || !analisador.ativo[pedidoId]) {
+        return false;
+    }
+
+    retirarDaWave(pedidoId);
+    verificador.removerPedido(pedidoId);
+    analisador.removerPedido(pedidoId);
+    backlog.pedido[pedidoId].clear();
+
+    pendente = true;
+    condicao.notify_all();
+    return true;
+}
+
+bool WaveOnline::processarEvento(const std::string& linha) {
+    std::istringstream ss(linha);
+    char operacao;
+    if (!(ss >> operacao) || operacao == '#') {
+        return false;
+    }
+
+    if (operacao == '+') {
+        int numItensPedido;
+        if (!(ss >> numItensPedido) || numItensPedido <= 0) {
+            throw std::runtime_error("Evento inválido: número de itens do pedido ausente");
+        }
+        std::map<int, int> pedido;
+        for (int j = 0; j < numItensPedido; j++) {
+            int itemId, quantidade;
+            if (!(ss >> itemId >> quantidade) || itemId < 0 || itemId >= deposito.numItens || quantidade <= 0) {
+                throw std::runtime_error("Evento inválido: item " + std::to_string(j) + " do pedido");
+            }
+            pedido[itemId] += quantidade;
+        }
+        incluirPedido(std::move(pedido));
+    } else if (operacao == '-') {
+        int pedidoId;
+        if (!(ss >> pedidoId) || !cancelarPedido(pedidoId)) {
+            throw std::runtime_error("Evento inválido: pedido inexistente ou já cancelado");
+        }
+    } else {
+        throw std::runtime_error("Evento desconhecido: " + std::string(1, operacao));
+    }
+    return true;
+}
+
+Solucao WaveOnline::getWave() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return wave;
+}
+
+bool WaveOnline::waveValida() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return !wave.corredoresWave.empty() && unidades >= backlog.wave.LB;
+}
+
+void WaveOnline::aguardarOtimizacao() {
+    std::unique_lock<std::mutex> lock(mutex);
+    condicao.wait(lock, [this]() { return !pendente && !ocupado; });
+}
+
+bool WaveOnline::tentarIncluirNaWave(int pedidoId, bool permitirNovosCorredores) {
+    int unidadesPedido = analisador.numUnidades[pedidoId];
+    if (!verificador.pedidoAtendivel(pedidoId) || wave.pedidosWave.contem(pedidoId) ||
+        unidades + unidadesPedido > backlog.wave.UB) {
+        return false;
+    }
+
+    // Corredores a abrir para cobrir os déficits (maior estoque primeiro)
+    std::vector<int> novosCorredores;
+    for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
+        int falta = demanda[itemId] + quantidade - oferta[itemId];
+        if (falta <= 0) continue;
+        if (!permitirNovosCorredores) return false;
+
+        for (int k = localizador.inicioItem[itemId];
+             k < localizador.inicioItem[itemId + 1] && falta > 0 && localizador.quantidadeOrdenada[k] > 0; k++) {
+            int corredorId = localizador.corredorOrdenado[k];
+            if (corredorAberto[corredorId] ||
+                std::find(novosCorredores.begin(), novosCorredores.end(), corredorId) != novosCorredores.end()) {
+                continue;
+            }
+            novosCorredores.push_back(corredorId);
+            falta -= localizador.quantidadeOrdenada[k];
+        }
+        if (falta > 0) return false;
+    }
+
+    for (int corredorId : novosCorredores) {
+        abrirCorredor(corredorId);
+    }
+    for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
+        demanda[itemId] += quantidade;
+    }
+    unidades += unidadesPedido;
+    wave.pedidosWave.inserir(pedidoId);
+    atualizarObjetivo();
+    return true;
+}
+
+void WaveOnline::retirarDaWave(int pedidoId) {
+    if (!wave.pedidosWave.remover(pedidoId)) {
+        return;
+    }
+    for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
+        demanda[itemId] -= quantidade;
+    }
+    unidades -= analisador.numUnidades[pedidoId];
+    atualizarObjetivo();
+}
+
+void WaveOnline::abrirCorredor(int corredorId) {
+    corredorAberto[corredorId] = 1;
+    wave.corredoresWave.push_back(corredorId);
+    for (const auto& [itemId, quantidade] : deposito.corredor[corredorId]) {
+        oferta[itemId] += quantidade;
+    }
+}
+
+void WaveOnline::atualizarObjetivo() {
+    wave.valorObjetivo = wave.corredoresWave.empty() ? 0.0 :
+                         static_cast<double>(unidades) / wave.corredoresWave.size();
+}
+
+void WaveOnline::publicar(const Solucao& nova, int numPedidosNaCopia) {
+    // Descontar pedidos cancelados enquanto a reotimização rodava
+    Solucao candidata;
+    candidata.corredoresWave = nova.corredoresWave;
+    int unidadesCandidata = 0;
+    for (int pedidoId : nova.pedidosWave) {
+        if (analisador.ativo[pedidoId]) {
+            candidata.pedidosWave.inserir(pedidoId);
+            unidadesCandidata += analisador.numUnidades[pedidoId];
+        }
+    }
+    if (candidata.corredoresWave.empty() || unidadesCandidata < backlog.wave.LB ||
+        unidadesCandidata > backlog.wave.UB) {
+        return;
+    }
+    double valorCandidata = static_cast<double>(unidadesCandidata) / candidata.corredoresWave.size();
+    bool atualValida = !wave.corredoresWave.empty() && unidades >= backlog.wave.LB;
+    if (atualValida && valorCandidata <= wave.valorObjetivo) {
+        return;
+    }
+
+    // Reconstruir demanda e oferta para a nova wave
+    std::fill(demanda.begin(), demanda.end(), 0);
+    std::fill(oferta.begin(), oferta.end(), 0);
+    std::fill(corredorAberto.begin(), corredorAberto.end(), 0);
+    wave = Solucao{};
+    unidades = 0;
+    for (int corredorId : candidata.corredoresWave) {
+        abrirCorredor(corredorId);
+    }
+    for (int pedidoId : candidata.pedidosWave) {
+        for (const auto& [itemId, quantidade] : backlog.pedido[pedidoId]) {
+            demanda[itemId] += quantidade;
+        }
+        wave.pedidosWave.inserir(pedidoId);
+    }
+    unidades = unidadesCandidata;
+    atualizarObjetivo();
+
+    // Pedidos que chegaram durante a reotimização entram se couberem na oferta já aberta
+    for (int pedidoId = numPedidosNaCopia; pedidoId < backlog.numPedidos; pedidoId++) {
+        tentarIncluirNaWave(pedidoId, false);
+    }
+}
+
+void WaveOnline::executarReotimizacao() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        condicao.wait(lock, [this]() { return parar || pendente; });
+        if (parar) break;
+
+        pendente = false;
+        ocupado = true;
+        // Uma falha (ex.: bad_alloc) descarta só esta reotimização: a wave corrente é mantida
+        try {
+            Solucao atual = wave;
+            Backlog copia;
+            copia.wave = backlog.wave;
+            copia.numPedidos = backlog.numPedidos;
+            copia.pedido.reserve(copia.numPedidos);
+
+            // Copiar o backlog em blocos, liberando o mutex entre eles para não atrasar os eventos;
+            // cancelamentos em blocos já copiados são descontados em publicar()
+            while (static_cast<int>(copia.pedido.size()) < copia.numPedidos) {
+                int inicio = static_cast<int>(copia.pedido.size());
+                int fim = std::min(copia.numPedidos, inicio + PEDIDOS_POR_BLOCO_COPIA);
+                copia.pedido.insert(copia.pedido.end(), backlog.pedido.begin() + inicio, backlog.pedido.begin() + fim);
+                lock.unlock();
+                lock.lock();
+            }
+            lock.unlock();
+
+            InstanciaPtr instancia = Instancia::criar(deposito, std::move(copia), base->getNumThreads());
+            SolucaoValidacao anterior{atual.pedidosWave.ids(), atual.corredoresWave};
+            Solucao nova = reotimizarSolucao(instancia, mapearSolucao(anterior, deposito, instancia->getBacklog()));
+
+            lock.lock();
+            publicar(nova, instancia->getBacklog().numPedidos);
+        } catch (const std::exception& e) {
+            if (!lock.owns_lock()) lock.lock();
+            std::cerr << "Erro na reotimização da wave online: " << e.what() << std::endl;
+        }
+        ocupado = false;
+        condicao.notify_all();
+    }
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "cache_instancias.h"
+#include "partida_quente.h"
+
+namespace {
+
+// Instância pequena: 2 pedidos, 3 itens, 2 corredores, LB 1 e UB 10
+std::string criarArquivoInstancia(const std::string& nome) {
+    std::filesystem::path caminho = std::filesystem::temp_directory_path() / nome;
+    std::ofstream arquivo(caminho);
+    arquivo << "2 3 2\n"
+            << "1 0 1\n"
+            << "2 1 1 2 1\n"
+            << "2 0 5 1 5\n"
+            << "1 2 5\n"
+            << "1 10\n";
+    return caminho.string();
+}
+
+InstanciaPtr aplicar(const Instancia& atual, const std::string& alteracoes) {
+    Deposito deposito = atual.getDeposito();
+    Backlog backlog = atual.getBacklog();
+    std::istringstream corpo(alteracoes);
+    aplicarDelta(deposito, backlog, corpo);
+    return Instancia::criar(std::move(deposito), std::move(backlog));
+}
+
+} // namespace
+
+TEST(CacheInstancias, ObterCarregaUmaVez) {
+    std::string caminho = criarArquivoInstancia("cache_obter.txt");
+    CacheInstancias cache;
+
+    CacheInstancias::Entrada primeira = cache.obter(caminho);
+    CacheInstancias::Entrada segunda = cache.obter(caminho);
+    EXPECT_EQ(primeira.instancia, segunda.instancia);
+    EXPECT_EQ(primeira.instancia->getBacklog().numPedidos, 2);
+    EXPECT_EQ(primeira.ultimaSolucao, nullptr);
+
+    std::filesystem::remove(caminho);
+}
+
+TEST(CacheInstancias, ModificarMantemUltimaSolucao) {
+    std::string caminho = criarArquivoInstancia("cache_solucao.txt");
+    CacheInstancias cache;
+
+    Solucao solucao;
+    solucao.valorObjetivo = 1.5;
+    cache.registrarSolucao(caminho, solucao);
+    InstanciaPtr nova = cache.modificar(caminho, [](const Instancia& atual) {
+        return aplicar(atual, "E 1 2 0\n");
+    });
+
+    CacheInstancias::Entrada entrada = cache.obter(caminho);
+    EXPECT_EQ(entrada.instancia, nova);
+    EXPECT_EQ(entrada.instancia->getDeposito().corredor[1].count(2), 0u);
+    ASSERT_NE(entrada.ultimaSolucao, nullptr);
+    EXPECT_DOUBLE_EQ(entrada.ultimaSolucao->valorObjetivo, 1.5);
+
+    std::filesystem::remove(caminho);
+}
+
+TEST(CacheInstancias, ModificacoesConcorrentesNaoSePerdem) {
+    std::string caminho = criarArquivoInstancia("cache_concorrente.txt");
+    CacheInstancias cache;
+
+    // Cada thread inclui pedidos num item próprio; todas as inclusões devem sobreviver
+    constexpr int numThreads = 4;
+    constexpr int inclusoesPorThread = 25;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&cache, &caminho, t]() {
+            std::string alteracao = "+ 1 " + std::to_string(t % 3) + " 1\n";
+            for (int i = 0; i < inclusoesPorThread; i++) {
+                cache.modificar(caminho, [&alteracao](const Instancia& atual) {
+                    // Alargar a janela entre a leitura e a publicação da instância
+                    std::this_thread::yield();
+                    return aplicar(atual, alteracao);
+                });
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const Backlog& backlog = cache.obter(caminho).instancia->getBacklog();
+    EXPECT_EQ(backlog.numPedidos, 2 + numThreads * inclusoesPorThread);
+    EXPECT_EQ(static_cast<int>(backlog.pedido.size()), backlog.numPedidos);
+
+    std::filesystem::remove(caminho);
+}
+
+TEST(CacheInstancias, ModificacaoComFalhaPreservaInstancia) {
+    std::string caminho = criarArquivoInstancia("cache_falha.txt");
+    CacheInstancias cache;
+    InstanciaPtr original = cache.obter(caminho).instancia;
+
+    EXPECT_THROW(cache.modificar(caminho, [](const Instancia& atual) {
+        return aplicar(atual, "- 99\n");
+    }), std::runtime_error);
+    EXPECT_EQ(cache.obter(caminho).instancia, original);
+
+    std::filesystem::remove(caminho);
+}
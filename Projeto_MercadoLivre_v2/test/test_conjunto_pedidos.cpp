@@ -0,0 +1,183 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <vector>
+#include "conjunto_pedidos.h"
+
+namespace {
+
+std::vector<int> ordenados(const ConjuntoPedidos& conjunto) {
+    std::vector<int> ids(conjunto.begin(), conjunto.end());
+    std::sort(ids.begin(), ids.end());
+    return ids;
+}
+
+// O vetor de IDs e o mapa de bits devem descrever o mesmo conjunto
+void verificarConsistencia(const ConjuntoPedidos& conjunto, int maiorId) {
+    std::set<int> noVetor(conjunto.begin(), conjunto.end());
+    ASSERT_EQ(noVetor.size(), conjunto.size()) << "IDs repetidos no vetor";
+    for (int pedidoId = 0; pedidoId <= maiorId; pedidoId++) {
+        EXPECT_EQ(conjunto.contem(pedidoId), noVetor.count(pedidoId) == 1) << "pedido " << pedidoId;
+    }
+}
+
+} // namespace
+
+TEST(ConjuntoPedidos, InserirRemoverContem) {
+    ConjuntoPedidos conjunto;
+    EXPECT_TRUE(conjunto.empty());
+    EXPECT_FALSE(conjunto.contem(0));
+
+    EXPECT_TRUE(conjunto.inserir(5));
+    EXPECT_TRUE(conjunto.inserir(2));
+    EXPECT_FALSE(conjunto.inserir(5));
+    EXPECT_EQ(conjunto.size(), 2u);
+    EXPECT_TRUE(conjunto.contem(5));
+    EXPECT_TRUE(conjunto.contem(2));
+    EXPECT_FALSE(conjunto.contem(3));
+    EXPECT_FALSE(conjunto.contem(1000));
+
+    EXPECT_TRUE(conjunto.remover(5));
+    EXPECT_FALSE(conjunto.remover(5));
+    EXPECT_FALSE(conjunto.remover(1000));
+    EXPECT_FALSE(conjunto.contem(5));
+    EXPECT_EQ(conjunto.ids(), std::vector<int>({2}));
+}
+
+TEST(ConjuntoPedidos, ConstrutorIgnoraRepeticoes) {
+    ConjuntoPedidos conjunto(std::vector<int>{3, 1, 3, 7, 1});
+    EXPECT_EQ(conjunto.ids(), std::vector<int>({3, 1, 7}));
+    verificarConsistencia(conjunto, 10);
+}
+
+TEST(ConjuntoPedidos, RemoverUltimoEUnico) {
+    ConjuntoPedidos conjunto(std::vector<int>{4, 9, 6});
+    EXPECT_TRUE(conjunto.remover(6));
+    EXPECT_EQ(conjunto.ids(), std::vector<int>({4, 9}));
+
+    // A remoção do meio traz o último para a posição liberada
+    EXPECT_TRUE(conjunto.remover(4));
+    EXPECT_EQ(conjunto.ids(), std::vector<int>({9}));
+
+    EXPECT_TRUE(conjunto.remover(9));
+    EXPECT_TRUE(conjunto.empty());
+    verificarConsistencia(conjunto, 10);
+
+    // O conjunto continua utilizável depois de esvaziado
+    EXPECT_TRUE(conjunto.inserir(9));
+    EXPECT_EQ(conjunto.ids(), std::vector<int>({9}));
+}
+
+TEST(ConjuntoPedidos, RemoverNaPosicao) {
+    ConjuntoPedidos conjunto(std::vector<int>{10, 20, 30, 40});
+    conjunto.removerNaPosicao(1);
+    EXPECT_EQ(conjunto.ids(), std::vector<int>({10, 40, 30}));
+    EXPECT_FALSE(conjunto.contem(20));
+
+    conjunto.removerNaPosicao(2);
+    EXPECT_EQ(conjunto.ids(), std::vector<int>({10, 40}));
+
+    conjunto.removerNaPosicao(0);
+    EXPECT_EQ(conjunto.ids(), std::vector<int>({40}));
+    EXPECT_TRUE(conjunto.remover(40));
+    verificarConsistencia(conjunto, 50);
+}
+
+TEST(ConjuntoPedidos, Limpar) {
+    ConjuntoPedidos conjunto(std::vector<int>{1, 63, 64, 200});
+    conjunto.limpar();
+    EXPECT_TRUE(conjunto.empty());
+    verificarConsistencia(conjunto, 256);
+
+    EXPECT_TRUE(conjunto.inserir(64));
+    EXPECT_TRUE(conjunto.inserir(1));
+    EXPECT_EQ(conjunto.ids(), std::vector<int>({64, 1}));
+    verificarConsistencia(conjunto, 256);
+}
+
+TEST(ConjuntoPedidos, CopiaNaoAlteraOriginal) {
+    ConjuntoPedidos original(std::vector<int>{1, 2, 3});
+    ConjuntoPedidos copia = original;
+    EXPECT_EQ(copia.ids(), original.ids());
+
+    copia.inserir(100);
+    copia.remover(1);
+    EXPECT_EQ(original.ids(), std::vector<int>({1, 2, 3}));
+    EXPECT_FALSE(original.contem(100));
+    EXPECT_TRUE(original.contem(1));
+    EXPECT_EQ(ordenados(copia), std::vector<int>({2, 3, 100}));
+
+    // E no sentido inverso: alterar o original não afeta uma cópia tirada antes
+    ConjuntoPedidos outra = original;
+    original.limpar();
+    EXPECT_EQ(outra.ids(), std::vector<int>({1, 2, 3}));
+    verificarConsistencia(outra, 128);
+}
+
+TEST(ConjuntoPedidos, Atribuir) {
+    ConjuntoPedidos origem(std::vector<int>{7, 70, 700});
+    ConjuntoPedidos destino(std::vector<int>{1, 2});
+
+    // Destino exclusivo: reaproveita os próprios vetores
+    destino.atribuir(origem);
+    EXPECT_EQ(destino.ids(), origem.ids());
+    verificarConsistencia(destino, 1000);
+    destino.inserir(8);
+    EXPECT_FALSE(origem.contem(8));
+
+    // Destino compartilhado: a outra cópia não pode ser afetada
+    ConjuntoPedidos compartilhado = destino;
+    destino.atribuir(ConjuntoPedidos(std::vector<int>{3}));
+    EXPECT_EQ(destino.ids(), std::vector<int>({3}));
+    EXPECT_EQ(ordenados(compartilhado), std::vector<int>({7, 8, 70, 700}));
+
+    // Atribuir a si mesmo não altera nada
+    destino.atribuir(destino);
+    EXPECT_EQ(destino.ids(), std::vector<int>({3}));
+}
+
+TEST(ConjuntoPedidos, LimitesDePalavra) {
+    const std::vector<int> limites = {0, 63, 64, 127, 128};
+    ConjuntoPedidos conjunto;
+    for (int pedidoId : limites) {
+        EXPECT_TRUE(conjunto.inserir(pedidoId));
+    }
+    EXPECT_FALSE(conjunto.contem(62));
+    EXPECT_FALSE(conjunto.contem(65));
+    EXPECT_FALSE(conjunto.contem(126));
+    EXPECT_FALSE(conjunto.contem(129));
+    verificarConsistencia(conjunto, 192);
+
+    EXPECT_TRUE(conjunto.remover(64));
+    EXPECT_TRUE(conjunto.contem(63));
+    EXPECT_TRUE(conjunto.contem(127));
+    EXPECT_TRUE(conjunto.remover(127));
+    EXPECT_TRUE(conjunto.contem(128));
+    EXPECT_EQ(ordenados(conjunto), std::vector<int>({0, 63, 128}));
+    verificarConsistencia(conjunto, 192);
+}
+
+TEST(ConjuntoPedidos, OperacoesAleatoriasContraReferencia) {
+    std::mt19937 gerador(12345);
+    std::uniform_int_distribution<int> idAleatorio(0, 300);
+    std::uniform_int_distribution<int> operacaoAleatoria(0, 9);
+
+    ConjuntoPedidos conjunto;
+    std::set<int> referencia;
+    for (int passo = 0; passo < 5000; passo++) {
+        int operacao = operacaoAleatoria(gerador);
+        int pedidoId = idAleatorio(gerador);
+        if (operacao < 5) {
+            EXPECT_EQ(conjunto.inserir(pedidoId), referencia.insert(pedidoId).second);
+        } else if (operacao < 9) {
+            EXPECT_EQ(conjunto.remover(pedidoId), referencia.erase(pedidoId) == 1);
+        } else {
+            ConjuntoPedidos copia = conjunto;
+            copia.limpar();
+            EXPECT_EQ(conjunto.size(), referencia.size());
+        }
+    }
+    EXPECT_EQ(ordenados(conjunto), std::vector<int>(referencia.begin(), referencia.end()));
+    verificarConsistencia(conjunto, 300);
+}
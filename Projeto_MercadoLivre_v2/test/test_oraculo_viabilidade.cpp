@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "localizador_itens.h"
+#include "oraculo_viabilidade.h"
+
+namespace {
+
+// Instância aleatória pequena, com itens concentrados para provocar disputa de estoque
+void gerarInstancia(std::mt19937& gerador, Deposito& deposito, Backlog& backlog) {
+    deposito.numItens = 8;
+    deposito.numCorredores = 6;
+    backlog.numPedidos = 10;
+    backlog.wave = {1, 100};
+
+    std::uniform_int_distribution<int> item(0, deposito.numItens - 1);
+    std::uniform_int_distribution<int> quantidade(1, 4);
+    std::uniform_int_distribution<int> tamanho(1, 3);
+
+    deposito.corredor.assign(deposito.numCorredores, {});
+    for (auto& corredor : deposito.corredor) {
+        for (int k = tamanho(gerador); k > 0; k--) corredor[item(gerador)] += quantidade(gerador);
+    }
+    backlog.pedido.assign(backlog.numPedidos, {});
+    for (auto& pedido : backlog.pedido) {
+        for (int k = tamanho(gerador); k > 0; k--) pedido[item(gerador)] += quantidade(gerador);
+    }
+}
+
+// Referência por força bruta: demanda e oferta recalculadas do zero
+struct Referencia {
+    const Deposito& deposito;
+    const Backlog& backlog;
+    std::vector<char> pedidos;
+    std::vector<char> corredores;
+
+    Referencia(const Deposito& d, const Backlog& b)
+        : deposito(d), backlog(b), pedidos(b.numPedidos, 0), corredores(d.numCorredores, 0) {}
+
+    std::vector<int> demanda() const {
+        std::vector<int> total(deposito.numItens, 0);
+        for (int p = 0; p < backlog.numPedidos; p++) {
+            if (!pedidos[p]) continue;
+            for (const auto& [itemId, qtd] : backlog.pedido[p]) total[itemId] += qtd;
+        }
+        return total;
+    }
+
+    std::vector<int> oferta(const std::vector<char>& abertos) const {
+        std::vector<int> total(deposito.numItens, 0);
+        for (int c = 0; c < deposito.numCorredores; c++) {
+            if (!abertos[c]) continue;
+            for (const auto& [itemId, qtd] : deposito.corredor[c]) total[itemId] += qtd;
+        }
+        return total;
+    }
+
+    int deficits(const std::vector<char>& abertos) const {
+        std::vector<int> d = demanda(), o = oferta(abertos);
+        int total = 0;
+        for (int i = 0; i < deposito.numItens; i++) total += d[i] > o[i];
+        return total;
+    }
+
+    bool viavel(const std::vector<char>& abertos) const { return deficits(abertos) == 0; }
+
+    bool cabeNaOferta(int pedidoId) const {
+        std::vector<int> d = demanda(), o = oferta(corredores);
+        for (const auto& [itemId, qtd] : backlog.pedido[pedidoId]) {
+            if (d[itemId] + qtd > o[itemId]) return false;
+        }
+        return true;
+    }
+
+    // Sem o corredor, todo item dele pedido pela wave continua coberto
+    bool podeFechar(int corredorId) const {
+        std::vector<char> abertos = corredores;
+        abertos[corredorId] = 0;
+        std::vector<int> d = demanda(), depois = oferta(abertos);
+        for (const auto& [itemId, qtd] : deposito.corredor[corredorId]) {
+            if (d[itemId] > 0 && d[itemId] > depois[itemId]) return false;
+        }
+        return true;
+    }
+};
+
+void compararComReferencia(const OraculoViabilidade& oraculo, const Referencia& referencia) {
+    ASSERT_EQ(oraculo.getNumItensEmDeficit(), referencia.deficits(referencia.corredores));
+    ASSERT_EQ(oraculo.viavel(), referencia.viavel(referencia.corredores));
+    for (int p = 0; p < referencia.backlog.numPedidos; p++) {
+        if (referencia.pedidos[p]) continue;
+        ASSERT_EQ(oraculo.cabeNaOferta(p), referencia.cabeNaOferta(p)) << "pedido " << p;
+    }
+    std::vector<int> abertos;
+    for (int c = 0; c < referencia.deposito.numCorredores; c++) {
+        if (referencia.corredores[c]) abertos.push_back(c);
+    }
+    ASSERT_EQ(oraculo.getCorredoresAbertos(), abertos);
+}
+
+} // namespace
+
+TEST(OraculoViabilidade, ContabilidadeIncrementalContraForcaBruta) {
+    std::mt19937 gerador(2025);
+    for (int instancia = 0; instancia < 50; instancia++) {
+        Deposito deposito;
+        Backlog backlog;
+        gerarInstancia(gerador, deposito, backlog);
+        OraculoViabilidade oraculo(deposito, backlog);
+        Referencia referencia(deposito, backlog);
+
+        std::uniform_int_distribution<int> operacao(0, 3);
+        std::uniform_int_distribution<int> pedido(0, backlog.numPedidos - 1);
+        std::uniform_int_distribution<int> corredor(0, deposito.numCorredores - 1);
+        for (int passo = 0; passo < 200; passo++) {
+            // Operações repetidas (incluir um pedido já incluído etc.) devem ser ignoradas
+            switch (operacao(gerador)) {
+                case 0: { int p = pedido(gerador); oraculo.adicionarPedido(p); referencia.pedidos[p] = 1; break; }
+                case 1: { int p = pedido(gerador); oraculo.removerPedido(p); referencia.pedidos[p] = 0; break; }
+                case 2: { int c = corredor(gerador); oraculo.abrirCorredor(c); referencia.corredores[c] = 1; break; }
+                default: {
+                    int c = corredor(gerador);
+                    if (referencia.corredores[c]) {
+                        ASSERT_EQ(oraculo.podeFecharCorredor(c), referencia.podeFechar(c)) << "corredor " << c;
+                    }
+                    oraculo.fecharCorredor(c);
+                    referencia.corredores[c] = 0;
+                    break;
+                }
+            }
+            compararComReferencia(oraculo, referencia);
+        }
+    }
+}
+
+TEST(OraculoViabilidade, CompletarReduzirEAtribuir) {
+    std::mt19937 gerador(7);
+    for (int instancia = 0; instancia < 100; instancia++) {
+        Deposito deposito;
+        Backlog backlog;
+        gerarInstancia(gerador, deposito, backlog);
+        LocalizadorItens localizador(deposito.numItens);
+        localizador.construir(deposito);
+
+        OraculoViabilidade oraculo(deposito, backlog);
+        Referencia referencia(deposito, backlog);
+        for (int p = 0; p < backlog.numPedidos; p++) {
+            if (gerador() % 2) {
+                oraculo.adicionarPedido(p);
+                referencia.pedidos[p] = 1;
+            }
+        }
+
+        // Completar deve tornar a wave viável sempre que o estoque total permitir
+        std::vector<char> todos(deposito.numCorredores, 1);
+        ASSERT_EQ(oraculo.completarCorredores(localizador), referencia.viavel(todos));
+        if (!oraculo.viavel()) continue;
+
+        // Depois de reduzir, cada corredor aberto é indispensável
+        oraculo.reduzirCorredores();
+        ASSERT_TRUE(oraculo.viavel());
+        std::vector<char> abertos(deposito.numCorredores, 0);
+        for (int c : oraculo.getCorredoresAbertos()) abertos[c] = 1;
+        ASSERT_TRUE(referencia.viavel(abertos));
+        for (int c = 0; c < deposito.numCorredores; c++) {
+            if (!abertos[c]) continue;
+            std::vector<char> semCorredor = abertos;
+            semCorredor[c] = 0;
+            EXPECT_FALSE(referencia.viavel(semCorredor)) << "corredor " << c << " é redundante";
+        }
+
+        // A atribuição cobre a demanda exata de cada item sem exceder o estoque dos corredores abertos
+        std::vector<int> atribuido(deposito.numItens, 0);
+        std::vector<std::vector<int>> usado(deposito.numCorredores, std::vector<int>(deposito.numItens, 0));
+        for (const auto& atribuicao : oraculo.atribuirEstoque(localizador)) {
+            ASSERT_TRUE(abertos[atribuicao.corredorId]);
+            ASSERT_GT(atribuicao.quantidade, 0);
+            atribuido[atribuicao.itemId] += atribuicao.quantidade;
+            usado[atribuicao.corredorId][atribuicao.itemId] += atribuicao.quantidade;
+        }
+        EXPECT_EQ(atribuido, referencia.demanda());
+        for (int c = 0; c < deposito.numCorredores; c++) {
+            for (int i = 0; i < deposito.numItens; i++) {
+                auto it = deposito.corredor[c].find(i);
+                EXPECT_LE(usado[c][i], it == deposito.corredor[c].end() ? 0 : it->second);
+            }
+        }
+    }
+}
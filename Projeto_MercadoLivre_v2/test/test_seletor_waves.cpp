@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <vector>
+#include "analisador_relevancia.h"
+#include "localizador_itens.h"
+#include "seletor_waves.h"
+
+namespace {
+
+// Instância aleatória com pedidos suficientes para dividir a varredura em vários blocos
+void gerarInstancia(std::mt19937& gerador, Deposito& deposito, Backlog& backlog, int numPedidos) {
+    deposito.numItens = 200;
+    deposito.numCorredores = 60;
+    backlog.numPedidos = numPedidos;
+    backlog.wave = {20, 120};
+
+    std::uniform_int_distribution<int> item(0, deposito.numItens - 1);
+    std::uniform_int_distribution<int> quantidade(1, 6);
+    std::uniform_int_distribution<int> tamanho(1, 4);
+
+    deposito.corredor.assign(deposito.numCorredores, {});
+    for (int itemId = 0; itemId < deposito.numItens; itemId++) {
+        deposito.corredor[itemId % deposito.numCorredores][itemId] += 50;
+    }
+    for (auto& corredor : deposito.corredor) {
+        for (int k = 0; k < 10; k++) corredor[item(gerador)] += quantidade(gerador);
+    }
+    backlog.pedido.assign(numPedidos, {});
+    for (auto& pedido : backlog.pedido) {
+        for (int k = tamanho(gerador); k > 0; k--) pedido[item(gerador)] += quantidade(gerador);
+    }
+}
+
+} // namespace
+
+TEST(SeletorWaves, ResultadoNaoDependeDoNumeroDeThreads) {
+    std::mt19937 gerador(99);
+    for (int numPedidos : {500, 3000, 9000}) {
+        Deposito deposito;
+        Backlog backlog;
+        gerarInstancia(gerador, deposito, backlog, numPedidos);
+        LocalizadorItens localizador(deposito.numItens);
+        localizador.construir(deposito);
+        AnalisadorRelevancia analisador(backlog.numPedidos);
+        analisador.construir(backlog, localizador, 1);
+        const std::vector<int>& ordenados = analisador.getPedidosOrdenadosPorRelevancia();
+
+        SeletorWaves seletor;
+        SeletorWaves::WaveCandidata sequencial = seletor.selecionarWaveOtima(backlog, ordenados, analisador,
+                                                                              localizador, 1);
+        ASSERT_FALSE(sequencial.pedidosIds.empty());
+        for (unsigned int numThreads : {2u, 3u, 5u, 8u}) {
+            SeletorWaves::WaveCandidata paralela = seletor.selecionarWaveOtima(backlog, ordenados, analisador,
+                                                                                localizador, numThreads);
+            EXPECT_EQ(paralela.pedidosIds, sequencial.pedidosIds) << numPedidos << " pedidos, " << numThreads << " threads";
+            EXPECT_EQ(paralela.totalUnidades, sequencial.totalUnidades);
+            EXPECT_EQ(paralela.corredoresNecessarios, sequencial.corredoresNecessarios);
+        }
+    }
+}
+
+TEST(SeletorWaves, BlocoRetomaAJanelaDaVarreduraSequencial) {
+    // 2048 pedidos de 1 unidade em 50 corredores distintos, exceto o pedido 1024 (início do
+    // segundo bloco com 2 threads), que tem 150 unidades num único corredor. A varredura
+    // sequencial nunca avalia a janela [1024, 1025) sozinha, pois chega a ela com o fim adiante
+    Deposito deposito;
+    deposito.numItens = 51;
+    deposito.numCorredores = 51;
+    deposito.corredor.assign(deposito.numCorredores, {});
+    for (int itemId = 0; itemId < deposito.numItens; itemId++) {
+        deposito.corredor[itemId][itemId] = 1000;
+    }
+    Backlog backlog;
+    backlog.numPedidos = 2048;
+    backlog.wave = {1, 200};
+    backlog.pedido.assign(backlog.numPedidos, {});
+    std::vector<int> ordem(backlog.numPedidos);
+    for (int pedidoId = 0; pedidoId < backlog.numPedidos; pedidoId++) {
+        backlog.pedido[pedidoId][pedidoId % 50] = 1;
+        ordem[pedidoId] = pedidoId;
+    }
+    backlog.pedido[1024] = {{50, 150}};
+
+    LocalizadorItens localizador(deposito.numItens);
+    localizador.construir(deposito);
+    AnalisadorRelevancia analisador(backlog.numPedidos);
+    analisador.construir(backlog, localizador, 1);
+
+    SeletorWaves seletor;
+    SeletorWaves::WaveCandidata sequencial = seletor.selecionarWaveOtima(backlog, ordem, analisador, localizador, 1);
+    SeletorWaves::WaveCandidata paralela = seletor.selecionarWaveOtima(backlog, ordem, analisador, localizador, 2);
+    EXPECT_EQ(paralela.pedidosIds, sequencial.pedidosIds);
+    EXPECT_NE(paralela.pedidosIds, std::vector<int>({1024}));
+}
+
+TEST(SeletorWaves, JanelaRespeitaLimitesEEstimativaDeCorredores) {
+    std::mt19937 gerador(5);
+    Deposito deposito;
+    Backlog backlog;
+    gerarInstancia(gerador, deposito, backlog, 2000);
+    LocalizadorItens localizador(deposito.numItens);
+    localizador.construir(deposito);
+    AnalisadorRelevancia analisador(backlog.numPedidos);
+    analisador.construir(backlog, localizador, 1);
+
+    SeletorWaves seletor;
+    SeletorWaves::WaveCandidata wave = seletor.selecionarWaveOtima(
+        backlog, analisador.getPedidosOrdenadosPorRelevancia(), analisador, localizador, 4);
+
+    int unidades = 0;
+    std::set<int> corredores;
+    for (int pedidoId : wave.pedidosIds) {
+        unidades += analisador.numUnidades[pedidoId];
+        for (int corredorId : localizador.getCorredoresPedido(backlog.pedido[pedidoId])) {
+            corredores.insert(corredorId);
+        }
+    }
+    EXPECT_EQ(unidades, wave.totalUnidades);
+    EXPECT_GE(unidades, backlog.wave.LB);
+    EXPECT_LE(unidades, backlog.wave.UB);
+    EXPECT_EQ(std::set<int>(wave.corredoresNecessarios.begin(), wave.corredoresNecessarios.end()), corredores);
+}